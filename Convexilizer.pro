@@ -1,36 +1,12 @@
-QT       += core gui
-
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
-
-CONFIG += c++17
-
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-
-SOURCES += \
-    convexhull.cpp \
-    grahamscan.cpp \
-    jarvismarch.cpp \
-    main.cpp \
-    mainwindow.cpp \
-    mergehull.cpp \
-    planewidget.cpp \
-    quickhull.cpp
-
-HEADERS += \
-    convexhull.h \
-    grahamscan.h \
-    jarvismarch.h \
-    mainwindow.h \
-    mergehull.h \
-    planewidget.h \
-    quickhull.h
-
-FORMS += \
-    mainwindow.ui
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
+# core: the hull algorithms as a static library that only needs QtCore
+# app:  the Qt Widgets visualizer
+# cli:  headless tools, linked against core alone
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    core \
+    app \
+    cli
+
+app.depends = core
+cli.depends = core
@@ -3,6 +3,9 @@
 #include <QIntValidator>
 #include "planewidget.h"
 #include <QElapsedTimer>
+#include <QFileDialog>
+#include <QMessageBox>
+#include <QStatusBar>
 #include <QLabel>
 
 MainWindow::MainWindow(QWidget *parent)
@@ -92,6 +95,12 @@ MainWindow::MainWindow(QWidget *parent)
                 switch (index) {
                 case 0: distributionType = PlaneWidget::Distribution::Uniform; break;
                 case 1: distributionType = PlaneWidget::Distribution::Gaussian; break;
+                case 2: distributionType = PlaneWidget::Distribution::Circle; break;
+                case 3: distributionType = PlaneWidget::Distribution::SquareBoundary; break;
+                case 4: distributionType = PlaneWidget::Distribution::Clusters; break;
+                case 5: distributionType = PlaneWidget::Distribution::Duplicates; break;
+                case 6: distributionType = PlaneWidget::Distribution::NearCollinear; break;
+                case 7: distributionType = PlaneWidget::Distribution::HeavyTail; break;
                 default: distributionType = PlaneWidget::Distribution::Uniform; break;
                 }
                 this->planeWidget->setDistribution(distributionType);
@@ -102,6 +111,61 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->point_style_dot_radio, &QRadioButton::toggled, this, &MainWindow::updatePointStyle);
     connect(ui->point_style_ellipsis, &QRadioButton::toggled, this, &MainWindow::updatePointStyle);
     connect(ui->gen_visible_checkbox, &QCheckBox::toggled, this, &MainWindow::handleVisibilityChange);
+    connect(ui->view_3d_checkbox, &QCheckBox::toggled, [this](bool checked) {
+        this->planeWidget->setViewMode(checked ? PlaneWidget::ViewMode::Space3D : PlaneWidget::ViewMode::Plane2D);
+    });
+    connect(ui->concave_k_slider, &QSlider::valueChanged, [this](int value) {
+        ui->concave_k_label->setText(QString("Neighbours (k): %1").arg(value));
+        this->planeWidget->setConcaveNeighbours(value);
+    });
+    connect(this->planeWidget, &PlaneWidget::animationFinished, this, &MainWindow::updateRuntimeLabel);
+    connect(this->planeWidget, &PlaneWidget::selectionChanged, this, &MainWindow::updateRuntimeLabel);
+    connect(ui->animation_speed_slider, &QSlider::valueChanged, [this](int value) {
+        this->planeWidget->setAnimationSpeed(value);
+    });
+    connect(ui->live_feed_checkbox, &QCheckBox::toggled, [this](bool checked) {
+        if (checked) {
+            QString numericText = ui->pointCount->text();
+            numericText.remove(',');
+            this->planeWidget->startLiveFeed(qMax(1, numericText.toInt()));
+        } else {
+            this->planeWidget->stopLiveFeed();
+        }
+    });
+    connect(ui->progressive_checkbox, &QCheckBox::toggled, [this](bool checked) {
+        this->planeWidget->setProgressive(checked);
+    });
+    connect(this->planeWidget, &PlaneWidget::hullProgress, [this](int percent) {
+        ui->hull_progress_bar->setValue(percent);
+        if (percent == 100)
+            updateRuntimeLabel();
+    });
+    connect(ui->polyline_checkbox, &QCheckBox::toggled, [this](bool checked) {
+        this->planeWidget->setPolylineMode(checked);
+    });
+    connect(this->planeWidget, &PlaneWidget::polylineNotSimple, [this](int repairs) {
+        statusBar()->showMessage(QString("The polyline is not simple, %1 vertices needed a general hull step").arg(repairs), 5000);
+    });
+    connect(ui->import_polyline_button, &QPushButton::clicked, [this]() {
+        QString path = QFileDialog::getOpenFileName(this, "Import polyline", QString(),
+                                                    "Polylines (*.txt *.csv *.bin);;All files (*)");
+        if (path.isEmpty())
+            return;
+        QString error;
+        if (!this->planeWidget->importPolyline(path, &error)) {
+            QMessageBox::warning(this, "Import polyline", error);
+            return;
+        }
+        ui->polyline_checkbox->setChecked(true);
+        updateRuntimeLabel();
+    });
+    connect(ui->kinetic_checkbox, &QCheckBox::toggled, [this](bool checked) {
+        if (checked) {
+            this->planeWidget->startKinetic();
+        } else {
+            this->planeWidget->stopKinetic();
+        }
+    });
 
 
 }
@@ -170,6 +234,7 @@ void MainWindow::updatePointStyle() {
 void MainWindow::on_pushButton_2_clicked()
 {
     // Generate button
+    ui->kinetic_checkbox->setChecked(false);
     QString numericText = ui->pointCount->text();
     numericText.remove(',');  // Remove commas before conversion
 
@@ -188,19 +253,46 @@ void MainWindow::on_pushButton_clicked()
         this->planeWidget->setAlgorithm(PlaneWidget::Algorithm::M);
     } else if (ui->radioButton_4->isChecked()) {
         this->planeWidget->setAlgorithm(PlaneWidget::Algorithm::Q);
+    } else if (ui->radioButton_5->isChecked()) {
+        this->planeWidget->setAlgorithm(PlaneWidget::Algorithm::A);
+    } else if (ui->radioButton_6->isChecked()) {
+        this->planeWidget->setAlgorithm(PlaneWidget::Algorithm::P);
+    } else if (ui->radioButton_7->isChecked()) {
+        this->planeWidget->setAlgorithm(PlaneWidget::Algorithm::C);
     }
 
+    if (!ui->progressive_checkbox->isChecked())
+        ui->hull_progress_bar->setValue(100);
     this->planeWidget->computeConvexHull();
+    updateRuntimeLabel();
+}
 
+void MainWindow::updateRuntimeLabel()
+{
     QLabel* runtimeLabel = findChild<QLabel*>("runtime_label");
-    runtimeLabel->setText(QString("Runtime: %1 ms").arg(this->planeWidget->getRuntime()));
+    // A negative runtime means an animated run is still playing
+    QString runtimeText = this->planeWidget->getRuntime() < 0
+        ? QString("Runtime: running")
+        : QString("Runtime: %1 ms").arg(this->planeWidget->getRuntime());
+    if (this->planeWidget->getErrorBound() > 0) {
+        runtimeText += QString("\nError bound: %1 px").arg(this->planeWidget->getErrorBound());
+    }
+    HullMetrics metrics = this->planeWidget->getHullMetrics();
+    runtimeText += QString("\nDiameter: %1 px").arg(metrics.diameter, 0, 'f', 1);
+    runtimeText += QString("\nWidth: %1 px").arg(metrics.width, 0, 'f', 1);
+    runtimeText += QString("\nBounding rectangle: %1 px²").arg(metrics.rectangleArea, 0, 'f', 0);
+    if (!this->planeWidget->selection().isEmpty()) {
+        runtimeText += QString("\nSelected: %1 points").arg(this->planeWidget->selection().size());
+    }
+    runtimeLabel->setText(runtimeText);
 
 }
 
 
 void MainWindow::on_checkBox_stateChanged(int arg1)
 {
-
+    Q_UNUSED(arg1);
+    this->planeWidget->toggleAnimateConvexHull();
 }
 
 
@@ -38,6 +38,7 @@ private slots:
     void on_pushButton_2_clicked();
     void handleVisibilityChange(bool checked);
     void on_pushButton_clicked();
+    void updateRuntimeLabel();
     void on_checkBox_stateChanged(int arg1);
     void on_pushButton_3_clicked();
 };
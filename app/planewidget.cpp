@@ -0,0 +1,796 @@
+#include "PlaneWidget.h"
+#include "hullutils.h"
+#include <random>
+#include <algorithm>
+#include <stack>
+#include <random>
+#include <cmath>
+#include <QRectF>
+#include <QPoint>
+#include <QVector>
+
+PlaneWidget::PlaneWidget(QWidget *parent) : QWidget(parent), m_animationActive(false) {
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+    setMouseTracking(true);
+    m_animationTimer = new QTimer(this);
+    connect(m_animationTimer, &QTimer::timeout, this, &PlaneWidget::updateHullAnimation);
+    m_feedTimer = new QTimer(this);
+    connect(m_feedTimer, &QTimer::timeout, this, &PlaneWidget::updateLiveFeed);
+    m_kineticTimer = new QTimer(this);
+    connect(m_kineticTimer, &QTimer::timeout, this, &PlaneWidget::updateKinetic);
+    m_progressTimer = new QTimer(this);
+    connect(m_progressTimer, &QTimer::timeout, this, &PlaneWidget::updateProgressiveHull);
+}
+
+void PlaneWidget::toggleAnimateConvexHull() {
+    m_animateConvexHull = !m_animateConvexHull;
+}
+
+void PlaneWidget::setAnimationSpeed(int speed) {
+    // Speeds 1 and 2 space single steps out, 3 to 5 run steps for part of every frame,
+    // up to most of it with the rest left for painting
+    static const int intervals[] = {200, 50, FrameInterval, FrameInterval, FrameInterval};
+    static const qint64 budgetsNs[] = {0, 0, 1'000'000, 4'000'000, 12'000'000};
+    const int level = qBound(1, speed, 5) - 1;
+    m_animationInterval = intervals[level];
+    m_stepBudgetNs = budgetsNs[level];
+    m_animationTimer->setInterval(m_animationInterval);
+}
+
+void PlaneWidget::startHullAnimation() {
+    stopHullAnimation();
+    setHullPoints(QVector<QPoint>());
+    m_stepper.reset(new HullStepper(this->algorithm));
+    this->runtime = -1;  // Running
+    m_animationActive = true;
+    m_animationTimer->start(m_animationInterval);
+}
+
+void PlaneWidget::stopHullAnimation() {
+    m_animationTimer->stop();
+    m_stepper.reset();
+    // A cancelled run has no runtime to show
+    this->runtime = std::max<qint64>(this->runtime, 0);
+    m_animationActive = false;
+    m_animatedEdges.clear();
+    m_currentEdge.clear();
+    m_overlayLayer.valid = false;
+}
+
+void PlaneWidget::updateHullAnimation() {
+    // Pull steps from the running algorithm until this frame's budget is used up or the
+    // algorithm has none ready, the GUI thread never waits for it
+    QElapsedTimer frame;
+    frame.start();
+    HullStep step;
+    do {
+        const HullStepper::Poll poll = m_stepper->tryNext(step);
+        if (poll == HullStepper::Poll::NotReady)
+            break;
+        if (poll == HullStepper::Poll::Finished) {
+            QVector<QPoint> hull = m_stepper->result();
+            this->runtime = m_stepper->runtimeMs();
+            stopHullAnimation();
+            setHullPoints(hull);
+            update();
+            emit animationFinished();
+            return;
+        }
+
+        switch (step.kind) {
+        case HullStep::Kind::Test:
+            m_currentEdge = {step.from, step.to};
+            break;
+        case HullStep::Kind::Accept:
+            m_animatedEdges.append(QLine(step.from, step.to));
+            break;
+        case HullStep::Kind::Reject:
+            for (int i = m_animatedEdges.size() - 1; i >= 0; i--) {
+                if (m_animatedEdges[i] == QLine(step.from, step.to)) {
+                    m_animatedEdges.remove(i);
+                    break;
+                }
+            }
+            break;
+        }
+    } while (frame.nsecsElapsed() < m_stepBudgetNs);
+
+    m_overlayLayer.valid = false;
+    update();  // Trigger a repaint to show the current state
+}
+
+void PlaneWidget::startLiveFeed(int windowPoints, bool simulateSensors) {
+    m_stream.clear();
+    m_streamArrivals.clear();
+    setPoints(QVector<QPoint>());
+    m_stream.setWindow(windowPoints);
+    m_feedClock.start();
+
+    m_sensors.clear();
+    if (simulateSensors) {
+        QRectF area = visibleArea();
+        std::uniform_real_distribution<> distribX(area.left(), area.right());
+        std::uniform_real_distribution<> distribY(area.top(), area.bottom());
+        for (int i = 0; i < 32; ++i) {
+            m_sensors.push_back(QPointF(distribX(m_feedRng), distribY(m_feedRng)));
+        }
+    }
+    m_feedTimer->start(16);  // Refresh the hull once per frame
+}
+
+void PlaneWidget::stopLiveFeed() {
+    m_feedTimer->stop();
+    m_sensors.clear();
+}
+
+void PlaneWidget::pushStreamPoint(const QPoint& point, qint64 timestampMs) {
+    m_stream.push(point, timestampMs);
+    m_streamArrivals.append(point);
+}
+
+void PlaneWidget::updateLiveFeed() {
+    if (!m_sensors.isEmpty()) {
+        qint64 now = m_feedClock.elapsed();
+        QPointF center = visibleArea().center();
+        std::normal_distribution<> noise(0.0, 2.0);
+        for (QPointF &sensor : m_sensors) {
+            for (int step = 0; step < 64; ++step) {
+                // Random walk, pulled gently back towards the middle of the view
+                sensor += QPointF(noise(m_feedRng), noise(m_feedRng)) + (center - sensor) * 0.0005;
+                pushStreamPoint(sensor.toPoint(), now);
+            }
+        }
+    }
+
+    // The window only changes when points arrive
+    if (m_streamArrivals.isEmpty())
+        return;
+
+    // Arrivals are appended and drawn on their own. Expired points stay on screen until
+    // they make up a sixteenth of the window, then the window is copied and drawn again,
+    // so a frame costs O(arrivals) amortized instead of O(window).
+    const int expired = m_points.size() + m_streamArrivals.size() - m_stream.size();
+    if (expired < 0 || expired > m_stream.size() / 16) {
+        setPoints(m_stream.windowPoints());
+    } else {
+        stopProgressiveHull();
+        m_grid.reset();
+        m_points += m_streamArrivals;
+        drawIntoPointLayer(m_streamArrivals.constData(), m_streamArrivals.size());
+    }
+    m_streamArrivals.clear();
+    setHullPoints(m_stream.hull());
+    update();
+}
+
+void PlaneWidget::startKinetic(double maxSpeed) {
+    stopHullAnimation();
+
+    // Random directions, speeds up to maxSpeed plane units per second
+    std::uniform_real_distribution<> angle(0.0, 2 * M_PI);
+    std::uniform_real_distribution<> speed(0.0, maxSpeed);
+    QVector<QPointF> velocities;
+    velocities.reserve(m_points.size());
+    for (int i = 0; i < m_points.size(); ++i) {
+        double a = angle(m_feedRng), s = speed(m_feedRng);
+        velocities.append(QPointF(s * std::cos(a), s * std::sin(a)));
+    }
+
+    m_kinetic.reset(new KineticHull(m_points, velocities));
+    setHullPoints(m_kinetic->hull());
+    m_kineticClock.start();
+    m_kineticTimer->start(FrameInterval);
+}
+
+void PlaneWidget::stopKinetic() {
+    m_kineticTimer->stop();
+    m_kinetic.reset();
+}
+
+void PlaneWidget::updateKinetic() {
+    QElapsedTimer timer;
+    timer.start();
+    double dt = m_kineticClock.restart() / 1000.0;
+    m_points = QVector<QPoint>();  // Release the shared positions, so moving them does not copy
+    m_kinetic->advance(dt);
+    setPoints(m_kinetic->points());
+    setHullPoints(m_kinetic->hull());
+    this->runtime = timer.elapsed();
+    update();
+}
+
+void PlaneWidget::setDistribution(Distribution d) {
+    this->dist = d;
+}
+
+void PlaneWidget::setViewMode(ViewMode mode) {
+    viewMode = mode;
+    setHullPoints(QVector<QPoint>());
+    m_hullFaces.clear();
+    update();
+}
+
+void PlaneWidget::generateRandomPoints(int pointCount) {
+    if (viewMode == ViewMode::Space3D) {
+        generateRandomPoints3D(pointCount);
+        return;
+    }
+
+    // Reset hull
+    setHullPoints(QVector<QPoint>());
+    QRectF area = onlyVisibleArea ? visibleArea() : QRectF(0, 0, width() * 10, height() * 10);
+
+    std::random_device rd;
+    setPoints(PointGenerator(this->dist, rd()).generate(pointCount, area));
+
+    // update();  // Update the widget to redraw the points
+}
+
+void PlaneWidget::generateRandomPoints3D(int pointCount) {
+    m_hullFaces.clear();
+    m_points3D.clear();
+    m_points3D.reserve(pointCount);
+
+    // Cloud centered on the origin, sized to fit the widget at zoom 1
+    double radius = qMin(width(), height()) * 0.4;
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    if (this->dist == Distribution::Gaussian) {
+        std::normal_distribution<> distrib(0.0, radius / 3);
+        for (int i = 0; i < pointCount; ++i) {
+            m_points3D.push_back(Point3D{distrib(gen), distrib(gen), distrib(gen)});
+        }
+    } else {
+        std::uniform_real_distribution<> distrib(-radius, radius);
+        for (int i = 0; i < pointCount; ++i) {
+            m_points3D.push_back(Point3D{distrib(gen), distrib(gen), distrib(gen)});
+        }
+    }
+}
+
+QSize PlaneWidget::sizeHint() const {
+    // Calculate the preferred size based on the zoom factor
+    return QSize(baseWidth * zoomFactor, baseHeight * zoomFactor);
+}
+
+void PlaneWidget::wheelEvent(QWheelEvent *event) {
+    const double scaleFactor = 1.1;
+    if (event->angleDelta().y() > 0) {
+        zoomFactor *= scaleFactor;
+    } else {
+        zoomFactor /= scaleFactor;
+    }
+    zoomFactor = qMax(0.1, zoomFactor); // Prevent excessive zoom out
+
+    updateGeometry(); // Notify layout system to recheck the sizeHint
+    update();         // Redraw the widget
+}
+
+
+double PlaneWidget::getZoomFactor() const {
+    return zoomFactor;
+}
+
+void PlaneWidget::setPointColor(QColor color) {
+    this->pointColor = color;
+    m_pointLayer.valid = false;
+}
+
+void PlaneWidget::mousePressEvent(QMouseEvent *event) {
+    if (event->button() == Qt::LeftButton && viewMode == ViewMode::Plane2D &&
+        (event->modifiers() & (Qt::ShiftModifier | Qt::ControlModifier))) {
+        m_selectionTool = (event->modifiers() & Qt::ShiftModifier) ? SelectionTool::Rectangle : SelectionTool::Lasso;
+        QPoint start = toPlane(event->pos());
+        m_selectionShape = QPolygon() << start << start;
+        return;
+    }
+    if (event->button() == Qt::LeftButton && viewMode == ViewMode::Plane2D && m_polylineMode) {
+        stopHullAnimation();
+        setPoints(QVector<QPoint>());
+        m_polylineHull.clear();
+        m_drawingPolyline = true;
+        addPolylineVertex(toPlane(event->pos()));
+        return;
+    }
+    if (event->button() == Qt::LeftButton) {
+        dragging = true;
+        dragActive = false;  // Reset drag activity flag
+        lastMousePosition = event->pos();
+    }
+}
+
+void PlaneWidget::addPolylineVertex(const QPoint& point) {
+    stopProgressiveHull();
+    m_grid.reset();
+    m_points.append(point);
+    m_pointLayer.valid = false;
+    // The hull follows the pen, each vertex costs O(1) amortized
+    m_polylineHull.push(point);
+    setHullPoints(m_polylineHull.hull());
+    update();
+}
+
+
+void PlaneWidget::addPoint(const QPoint& point) {
+    stopProgressiveHull();  // Its hull would miss the new point
+    m_grid.reset();  // Built again on the next selection
+    m_points.append(point);
+    drawIntoPointLayer(&point, 1);
+}
+
+void PlaneWidget::drawIntoPointLayer(const QPoint* points, int count) {
+    if (!m_pointLayer.valid)
+        return;
+    // Draw just the new points into the cached layer, with the transform the layer uses
+    QPainter painter(&m_pointLayer.pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.translate(m_pointLayer.translation);
+    painter.scale(m_pointLayer.zoom, m_pointLayer.zoom);
+    drawPointBatch(painter, points, count);
+}
+
+void PlaneWidget::mouseMoveEvent(QMouseEvent *event) {
+    if (m_selectionTool != SelectionTool::None) {
+        QPoint position = toPlane(event->pos());
+        if (m_selectionTool == SelectionTool::Rectangle)
+            m_selectionShape[1] = position;
+        else if (position != m_selectionShape.last())
+            m_selectionShape.append(position);
+        update();
+    } else if (m_drawingPolyline) {
+        QPoint position = toPlane(event->pos());
+        if (position != m_points.last())
+            addPolylineVertex(position);
+    } else if (dragging && viewMode == ViewMode::Space3D) {
+        // Dragging rotates the point cloud instead of panning
+        QPoint mouseDelta = event->pos() - lastMousePosition;
+        yaw += mouseDelta.x() * 0.01;
+        pitch += mouseDelta.y() * 0.01;
+        lastMousePosition = event->pos();
+        dragActive = true;
+        update();
+    } else if (dragging) {
+        QPoint mouseDelta = event->pos() - lastMousePosition;
+        if (mouseDelta.manhattanLength() > 5) {  // Threshold for drag start
+            translateX += mouseDelta.x();
+            translateY += mouseDelta.y();
+            update();  // Update the widget to reflect the translation
+            lastMousePosition = event->pos();
+            dragActive = true;  // Indicate that actual dragging has occurred
+        }
+    }
+}
+
+void PlaneWidget::mouseReleaseEvent(QMouseEvent *event) {
+    if (event->button() == Qt::LeftButton && m_selectionTool != SelectionTool::None) {
+        finishSelection();
+        return;
+    }
+    if (event->button() == Qt::LeftButton && m_drawingPolyline) {
+        m_drawingPolyline = false;
+        return;
+    }
+    if (event->button() == Qt::LeftButton) {
+        if (!dragActive && viewMode == ViewMode::Plane2D) {  // It was a click, not a drag
+            addPoint(toPlane(event->pos()));  // Add the point where the click occurred
+            update();  // Redraw to show the new point
+        }
+        if (dragActive) {
+            update();  // Render the layers again at the final position of the pan
+        }
+        dragging = false;
+        dragActive = false;  // Reset drag activity flag
+    }
+}
+
+void PlaneWidget::paintEvent(QPaintEvent *event) {
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    if (viewMode == ViewMode::Space3D) {
+        paintSpace(painter);
+        return;
+    }
+
+    // Layers are only drawn again when their content or the zoom changed, or when a pan ended
+    if (!layerUsable(m_pointLayer))
+        renderPointLayer();
+    if (!layerUsable(m_overlayLayer))
+        renderOverlayLayer();
+    if (!layerUsable(m_hullLayer))
+        renderHullLayer();
+
+    QPointF translation(translateX, translateY);
+    painter.drawPixmap(translation - m_pointLayer.translation, m_pointLayer.pixmap);
+    painter.drawPixmap(translation - m_overlayLayer.translation, m_overlayLayer.pixmap);
+    painter.drawPixmap(translation - m_hullLayer.translation, m_hullLayer.pixmap);
+
+    // Rubber band of a selection in progress
+    if (m_selectionTool != SelectionTool::None) {
+        painter.translate(translation);
+        painter.scale(zoomFactor, zoomFactor);
+        painter.setPen(QPen(Qt::yellow, 0, Qt::DashLine));
+        if (m_selectionTool == SelectionTool::Rectangle)
+            painter.drawRect(QRect(m_selectionShape[0], m_selectionShape[1]).normalized());
+        else
+            painter.drawPolygon(m_selectionShape);
+    }
+}
+
+QPoint PlaneWidget::toPlane(const QPointF& pos) const {
+    double invZoom = 1.0 / zoomFactor;
+    return QPoint(static_cast<int>((pos.x() - translateX) * invZoom),
+                  static_cast<int>((pos.y() - translateY) * invZoom));
+}
+
+const SpatialGrid& PlaneWidget::spatialIndex() {
+    if (!m_grid)
+        m_grid.reset(new SpatialGrid(m_points));
+    return *m_grid;
+}
+
+void PlaneWidget::finishSelection() {
+    stopHullAnimation();
+    stopProgressiveHull();
+    const SpatialGrid& grid = spatialIndex();
+    QElapsedTimer timer;
+    timer.start();
+
+    // The grid hands back the selected points with their indices, m_points is not copied
+    m_selectedPoints.clear();
+    if (m_selectionTool == SelectionTool::Rectangle)
+        m_selection = grid.query(QRect(m_selectionShape[0], m_selectionShape[1]).normalized(), &m_selectedPoints);
+    else
+        m_selection = grid.query(m_selectionShape, &m_selectedPoints);
+    m_selectionTool = SelectionTool::None;
+    m_selectionShape.clear();
+
+    QVector<QPoint> candidates = m_selectedPoints;
+    HullUtils::discardInterior(candidates);
+    setHullPoints(HullUtils::monotoneChain(candidates));
+    this->runtime = timer.elapsed();
+
+    m_overlayLayer.valid = false;
+    update();
+    emit selectionChanged();
+}
+
+const QVector<int>& PlaneWidget::selection() const {
+    return m_selection;
+}
+
+void PlaneWidget::clearSelection() {
+    m_selection.clear();
+    m_selectedPoints.clear();
+    m_overlayLayer.valid = false;
+    emit selectionChanged();
+}
+
+void PlaneWidget::setPoints(const QVector<QPoint>& points) {
+    stopProgressiveHull();
+    m_points = points;
+    m_grid.reset();
+    m_pointLayer.valid = false;
+    if (!m_selection.isEmpty())
+        clearSelection();
+}
+
+void PlaneWidget::setHullPoints(const QVector<QPoint>& hull) {
+    m_hullPoints = hull;
+    m_hullMetrics = RotatingCalipers::measure(HullUtils::monotoneChain(hull)); // Also right for concave outlines
+    m_hullLayer.valid = false;
+}
+
+bool PlaneWidget::layerUsable(const Layer& layer) const {
+    if (!layer.valid || layer.zoom != zoomFactor || layer.pixmap.size() != size() * devicePixelRatioF())
+        return false;
+    // While dragging the layer is moved, not redrawn
+    return dragActive || layer.translation == QPointF(translateX, translateY);
+}
+
+void PlaneWidget::beginLayer(Layer& layer, QPainter& painter) {
+    qreal ratio = devicePixelRatioF();
+    if (layer.pixmap.size() != size() * ratio) {
+        layer.pixmap = QPixmap(size() * ratio);
+        layer.pixmap.setDevicePixelRatio(ratio);
+    }
+    layer.pixmap.fill(Qt::transparent);
+    layer.translation = QPointF(translateX, translateY);
+    layer.zoom = zoomFactor;
+    layer.valid = true;
+
+    painter.begin(&layer.pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.translate(layer.translation);
+    painter.scale(layer.zoom, layer.zoom);
+}
+
+void PlaneWidget::drawPointBatch(QPainter& painter, const QPoint* points, int count) const {
+    painter.setPen(this->pointColor);
+    switch (currentStyle) {
+    case PointStyle::Dot:
+        painter.drawPoints(points, count);
+        break;
+    case PointStyle::Ellipsis:
+        for (int i = 0; i < count; i++) {
+            painter.drawEllipse(points[i], 3, 3);
+        }
+        break;
+    }
+}
+
+void PlaneWidget::renderPointLayer() {
+    QPainter painter;
+    beginLayer(m_pointLayer, painter);
+    if (m_polylineMode) {
+        painter.setPen(this->pointColor);
+        painter.drawPolyline(m_points.constData(), m_points.size());
+        return;
+    }
+    drawPointBatch(painter, m_points.constData(), m_points.size());
+}
+
+void PlaneWidget::renderOverlayLayer() {
+    // Draw the selected points, the hull built so far and the current edge being tested
+    QPainter painter;
+    beginLayer(m_overlayLayer, painter);
+    painter.setPen(Qt::yellow);
+    painter.drawPoints(m_selectedPoints.constData(), m_selectedPoints.size());
+    painter.setPen(Qt::red);
+    painter.drawLines(m_animatedEdges);
+    painter.setPen(Qt::blue);
+    painter.drawPolyline(m_currentEdge.constData(), m_currentEdge.size());
+}
+
+void PlaneWidget::renderHullLayer() {
+    // Draw the convex hull as one batch of lines
+    QPainter painter;
+    beginLayer(m_hullLayer, painter);
+    painter.setPen(Qt::red);
+    QVector<QLine> edges;
+    edges.reserve(m_hullPoints.size());
+    for (int i = 0; i < m_hullPoints.size(); i++) {
+        int nextIndex = (i + 1) % m_hullPoints.size();
+        edges.append(QLine(m_hullPoints[i], m_hullPoints[nextIndex]));
+    }
+    painter.drawLines(edges);
+
+    // Minimum-area bounding rectangle
+    if (m_hullMetrics.rectangleArea > 0) {
+        painter.setPen(QPen(Qt::gray, 0, Qt::DashLine));
+        painter.drawPolygon(m_hullMetrics.rectangle.constData(), m_hullMetrics.rectangle.size());
+    }
+}
+
+Point3D PlaneWidget::rotate(const Point3D& p) const {
+    // Yaw around the y axis, then pitch around the x axis
+    double x = p.x * std::cos(yaw) + p.z * std::sin(yaw);
+    double z = -p.x * std::sin(yaw) + p.z * std::cos(yaw);
+    double y = p.y * std::cos(pitch) - z * std::sin(pitch);
+    z = p.y * std::sin(pitch) + z * std::cos(pitch);
+    return Point3D{x, y, z};
+}
+
+QPointF PlaneWidget::toScreen(const Point3D& rotated) const {
+    // Orthographic projection along z, y points up on screen
+    return QPointF(width() / 2.0 + rotated.x * zoomFactor, height() / 2.0 - rotated.y * zoomFactor);
+}
+
+void PlaneWidget::paintSpace(QPainter& painter) {
+    // Draw all points
+    QVector<QPointF> projected;
+    projected.reserve(m_points3D.size());
+    for (const Point3D &point : m_points3D) {
+        projected.append(toScreen(rotate(point)));
+    }
+    painter.setPen(this->pointColor);
+    painter.drawPoints(projected.constData(), projected.size());
+
+    // Draw the hull faces that face the viewer, shaded by their angle to the view direction.
+    // The hull is convex so these never overlap and need no depth sorting.
+    painter.setPen(Qt::red);
+    for (const Face3D &face : m_hullFaces) {
+        Point3D a = rotate(m_points3D[face.a]);
+        Point3D b = rotate(m_points3D[face.b]);
+        Point3D c = rotate(m_points3D[face.c]);
+        double nx = (b.y - a.y) * (c.z - a.z) - (b.z - a.z) * (c.y - a.y);
+        double ny = (b.z - a.z) * (c.x - a.x) - (b.x - a.x) * (c.z - a.z);
+        double nz = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        if (nz <= 0)
+            continue;
+
+        double shade = nz / std::sqrt(nx * nx + ny * ny + nz * nz);
+        painter.setBrush(QColor::fromRgbF(0.9 * shade, 0.2 * shade, 0.2 * shade, 0.5));
+        QPointF triangle[3] = {toScreen(a), toScreen(b), toScreen(c)};
+        painter.drawPolygon(triangle, 3);
+    }
+}
+
+void PlaneWidget::setOnlyVisible(bool visible) {
+    onlyVisibleArea = visible;
+}
+
+void PlaneWidget::setPointStyle(PointStyle style) {
+    currentStyle = style;
+    m_pointLayer.valid = false;
+}
+
+QRectF PlaneWidget::visibleArea() const {
+    double visibleWidth = width() / zoomFactor;
+    double visibleHeight = height() / zoomFactor;
+    double left = -translateX / zoomFactor;
+    double top = -translateY / zoomFactor;
+    return QRectF(left, top, visibleWidth, visibleHeight);
+}
+
+
+
+// Helper function to find the orientation of the ordered triplet (p, q, r).
+// The function returns following values
+// 0 -> p, q and r are collinear
+// 1 -> Clockwise
+// 2 -> Counterclockwise
+int orientation(const QPoint &p, const QPoint &q, const QPoint &r) {
+    int val = (q.y() - p.y()) * (r.x() - q.x()) -
+              (q.x() - p.x()) * (r.y() - q.y());
+    if (val == 0) return 0;  // collinear
+    return (val > 0) ? 1: 2; // clock or counterclock wise
+}
+
+void PlaneWidget::setAlgorithm(Algorithm algorithm) {
+    stopHullAnimation();
+    delete this->algorithm;
+    if (algorithm == Algorithm::C)
+        this->algorithm = new ConcaveHull(this->m_points, concaveNeighbours);
+    else
+        this->algorithm = createHull(algorithm, this->m_points);
+}
+
+void PlaneWidget::setConcaveNeighbours(int k) {
+    concaveNeighbours = k;
+}
+
+qint64 PlaneWidget::getRuntime() {
+    return this->runtime;
+}
+
+HullMetrics PlaneWidget::getHullMetrics() const {
+    return m_hullMetrics;
+}
+
+double PlaneWidget::getErrorBound() {
+    return this->algorithm ? this->algorithm->errorBound() : 0.0;
+}
+
+// Function to implement Graham's scan convex hull algorithm
+void PlaneWidget::computeConvexHull() {
+    stopProgressiveHull();
+    QElapsedTimer timer;
+    timer.start();  // Start the timer just before the computation
+    if (viewMode == ViewMode::Space3D) {
+        m_hullFaces = QuickHull3D(m_points3D).compute();
+        this->runtime = timer.elapsed();
+        update();
+        return;
+    }
+    if (m_animateConvexHull) {
+        // The hull and its runtime are set once the animation has played out
+        startHullAnimation();
+        return;
+    }
+    if (m_polylineMode) {
+        // Ordered input takes linear time, unless the chain turns out not to be simple
+        MelkmanHull melkman;
+        for (const QPoint& point : m_points)
+            melkman.push(point);
+        if (melkman.repairCount() == 0) {
+            setHullPoints(melkman.hull());
+            this->runtime = timer.elapsed();
+            update();
+            return;
+        }
+        emit polylineNotSimple(melkman.repairCount());
+    }
+    if (m_progressiveMode) {
+        // The worker publishes refined hulls, picked up once per frame
+        m_progressive.reset(new ProgressiveHull(m_points));
+        m_progressClock.start();
+        m_progressRevision = m_progressive->revision();
+        setHullPoints(m_progressive->hull());
+        this->runtime = timer.elapsed();
+        if (!m_progressive->finished())
+            m_progressTimer->start(FrameInterval);
+        emit hullProgress(qRound(m_progressive->progress() * 100));
+        update();
+        return;
+    }
+    setHullPoints(this->algorithm->compute());
+    this->runtime = timer.elapsed();  // Get the elapsed time in milliseconds
+    update();
+}
+
+void PlaneWidget::setProgressive(bool enabled) {
+    m_progressiveMode = enabled;
+}
+
+void PlaneWidget::updateProgressiveHull() {
+    if (m_progressive->revision() == m_progressRevision)
+        return;
+    // Finished first, so the hull read after it is the exact one
+    bool finished = m_progressive->finished();
+    m_progressRevision = m_progressive->revision();
+    setHullPoints(m_progressive->hull());
+    if (finished) {
+        this->runtime = m_progressClock.elapsed();
+        m_progressTimer->stop();
+    }
+    emit hullProgress(qRound(m_progressive->progress() * 100));
+    update();
+}
+
+void PlaneWidget::stopProgressiveHull() {
+    m_progressTimer->stop();
+    m_progressive.reset();
+}
+
+void PlaneWidget::setPolylineMode(bool enabled) {
+    stopProgressiveHull();
+    m_polylineMode = enabled;
+    m_pointLayer.valid = false;
+    update();
+}
+
+bool PlaneWidget::importPolyline(const QString& path, QString* error) {
+    // The hull is built while the file streams in
+    MelkmanHull melkman;
+    QVector<QPoint> points;
+    if (!melkman.readFile(path, &points)) {
+        if (error)
+            *error = melkman.errorString();
+        return false;
+    }
+    if (melkman.repairCount() > 0)
+        emit polylineNotSimple(melkman.repairCount());
+
+    stopHullAnimation();
+    setPoints(points);
+    setHullPoints(melkman.hull());
+    update();
+    return true;
+}
+
+void PlaneWidget::runTests() {
+    QVector<Distribution> distributions = PointGenerator::all();
+    std::vector<Algorithm> algorithms{Algorithm::G, Algorithm::J, Algorithm::M, Algorithm::Q, Algorithm::A, Algorithm::P};
+    std::vector<int> pointCounts{1'000'000};
+    setOnlyVisible(false);
+    for (auto dist : distributions) {
+        qDebug() << "Testing " << PointGenerator::name(dist);
+        setDistribution(dist);
+            for (auto pointCount : pointCounts) {
+                for (int step = 6; step < 9; step++) {
+                    generateRandomPoints(pointCount + pointCount * step);
+                    qDebug() << "Points: " << pointCount + pointCount * step;
+                    for (auto algo : algorithms) {
+                        if (algo == Algorithm::J && dist == Distribution::Circle) {
+                            qDebug() << "Skipping Jarvis March, O(nh) with h in the thousands";
+                            continue;
+                        }
+                        setAlgorithm(algo);
+                        QString s = hullAlgorithmName(algo);
+                        auto start = std::chrono::high_resolution_clock::now();
+                        setHullPoints(algorithm->compute());
+                        auto end = std::chrono::high_resolution_clock::now();
+                        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+                        qDebug() << "Algorithm: " << s << " Runtime: " << duration << " ms"
+                                 << " Error bound: " << algorithm->errorBound();
+                        setHullPoints(QVector<QPoint>());
+                }
+
+            }
+        }
+    }
+}
+
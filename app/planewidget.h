@@ -0,0 +1,214 @@
+// PlaneWidget.h
+#ifndef PLANEWIDGET_H
+#define PLANEWIDGET_H
+
+#include <QWidget>
+#include <QPainter>
+#include <QVector>
+#include <QPoint>
+#include <QWheelEvent>
+#include <QTimer>
+#include <QPixmap>
+#include <QPolygon>
+#include <QElapsedTimer>
+#include <memory>
+#include <random>
+#include "concavehull.h"
+#include "convexhull.h"
+#include "hullalgorithms.h"
+#include "hullstepper.h"
+#include "kinetichull.h"
+#include "melkmanhull.h"
+#include "pointgenerator.h"
+#include "progressivehull.h"
+#include "quickhull3d.h"
+#include "rotatingcalipers.h"
+#include "slidingwindowhull.h"
+#include "spatialgrid.h"
+
+class PlaneWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit PlaneWidget(QWidget *parent = nullptr);
+    void generateRandomPoints(int pointCount);
+
+    void wheelEvent(QWheelEvent *event) override;
+    QSize sizeHint() const override;
+    double getZoomFactor() const;
+    void setPointColor(QColor color);
+    double getTranslateX() const;
+    double getTranslateY() const;
+
+    enum class PointStyle { Dot, Ellipsis };
+
+    using Algorithm = HullAlgorithm;
+    void setAlgorithm(Algorithm algorithm);
+    void setConcaveNeighbours(int k);
+
+    using Distribution = PointGenerator::Distribution;
+    void setDistribution(Distribution d);
+
+    enum class ViewMode { Plane2D, Space3D };
+    void setViewMode(ViewMode mode);
+
+    void setPointStyle(PointStyle style);
+    QRectF visibleArea() const;
+    void setOnlyVisible(bool visible);
+    bool onlyVisibleArea = true;
+    void addPoint(const QPoint& point);
+
+    void computeConvexHull();
+    // Progressive mode: computeConvexHull() shows a sampled hull within a frame and
+    // replaces it as the background refinement goes on
+    void setProgressive(bool enabled);
+    void toggleAnimateConvexHull();
+    void startHullAnimation();
+    void stopHullAnimation();
+    void setAnimationSpeed(int speed);
+    void runTests();
+
+    // Live feed: the hull follows a sliding window over a stream of points
+    void startLiveFeed(int windowPoints, bool simulateSensors = true);
+    void stopLiveFeed();
+    void pushStreamPoint(const QPoint& point, qint64 timestampMs);
+
+    // Polyline mode: the points are the vertices of one polyline in order, a drag draws a
+    // new one and the hull comes from Melkman's linear algorithm
+    void setPolylineMode(bool enabled);
+    bool importPolyline(const QString& path, QString* error = nullptr);
+
+    // Kinetic mode: every point drifts with its own velocity and the hull follows each frame
+    void startKinetic(double maxSpeed = 40.0);
+    void stopKinetic();
+
+    // Selection: shift-drag selects a rectangle, ctrl-drag a freehand lasso, and the hull
+    // of the selected points replaces the hull
+    const QVector<int>& selection() const;
+    void clearSelection();
+
+    qint64 getRuntime();
+    double getErrorBound();
+    HullMetrics getHullMetrics() const;
+
+signals:
+    void animationFinished();
+    void selectionChanged();
+    void hullProgress(int percent);
+    // The polyline crosses itself, repairs of its vertices needed a general hull step
+    void polylineNotSimple(int repairs);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+
+private slots:
+    void updateHullAnimation();
+    void updateLiveFeed();
+    void updateKinetic();
+    void updateProgressiveHull();
+
+private:
+    QVector<QPoint> m_points;
+    double zoomFactor = 1.0;
+    int baseWidth = 800;   // Base width without zoom
+    int baseHeight = 600;  // Base height without zoom
+    QColor pointColor = Qt::white;
+
+    double translateX = 0.0;  // X translation of the view
+    double translateY = 0.0;  // Y translation of the view
+
+    bool dragging = false;
+    QPoint lastMousePosition;
+
+    PointStyle currentStyle = PointStyle::Dot; // Default dot
+    bool dragActive = false;
+    QPoint toPlane(const QPointF& pos) const;
+
+    enum class SelectionTool { None, Rectangle, Lasso };
+    SelectionTool m_selectionTool = SelectionTool::None; // Tool of the selection drag in progress
+    QPolygon m_selectionShape;            // Rubber band in plane coordinates, two corners for a rectangle
+    QVector<int> m_selection;             // Indices into m_points of the selected points
+    QVector<QPoint> m_selectedPoints;     // The selected points, for drawing and the hull
+    std::unique_ptr<SpatialGrid> m_grid;  // Index over m_points, built on the first selection
+    const SpatialGrid& spatialIndex();
+    void finishSelection();
+
+    QVector<QPoint> m_hullPoints;  // Stores the final hull points
+    HullMetrics m_hullMetrics;     // Diameter, width and bounding rectangle of m_hullPoints
+    QVector<QPoint> m_currentEdge;  // Temporarily store the current edge being tested
+
+    bool m_animateConvexHull = false;
+    QTimer *m_animationTimer;
+    bool m_animationActive;
+    static constexpr int FrameInterval = 16;
+    int m_animationInterval = 200;  // Speed 1, the slider's initial value
+    qint64 m_stepBudgetNs = 0;              // Time spent on steps per frame, 0 for one step
+    std::unique_ptr<HullStepper> m_stepper; // The animated run, producing steps on demand
+    QVector<QLine> m_animatedEdges;         // Edges accepted so far by the animation
+
+    ConvexHull *algorithm = nullptr;
+    int concaveNeighbours = ConcaveHull::DefaultNeighbours;
+    qint64 runtime = 0;
+
+    Distribution dist = Distribution::Uniform;
+
+    // 3D point cloud, shown as a rotatable orthographic projection
+    ViewMode viewMode = ViewMode::Plane2D;
+    QVector<Point3D> m_points3D;
+    QVector<Face3D> m_hullFaces;
+    double yaw = 0.6;    // Rotation around the vertical axis
+    double pitch = -0.4; // Rotation around the horizontal axis
+    void generateRandomPoints3D(int pointCount);
+    Point3D rotate(const Point3D& p) const;
+    QPointF toScreen(const Point3D& rotated) const;
+    void paintSpace(QPainter& painter);
+
+    // Cached rendering layers. Each is a widget sized pixmap remembering the view
+    // transform it was drawn with, so a pan only moves the pixmaps until the drag ends.
+    struct Layer {
+        QPixmap pixmap;
+        QPointF translation;
+        double zoom = 0.0;
+        bool valid = false;
+    };
+    Layer m_pointLayer;
+    Layer m_overlayLayer;  // Animation steps
+    Layer m_hullLayer;
+    bool layerUsable(const Layer& layer) const;
+    void beginLayer(Layer& layer, QPainter& painter);
+    void drawPointBatch(QPainter& painter, const QPoint* points, int count) const;
+    void drawIntoPointLayer(const QPoint* points, int count);
+    void renderPointLayer();
+    void renderOverlayLayer();
+    void renderHullLayer();
+    void setPoints(const QVector<QPoint>& points);
+    void setHullPoints(const QVector<QPoint>& hull);
+
+    SlidingWindowHull m_stream{100'000};
+    QTimer *m_feedTimer;
+    QElapsedTimer m_feedClock;
+    QVector<QPointF> m_sensors; // Simulated sensors feeding the stream, random walking
+    QVector<QPoint> m_streamArrivals; // Pushed since the last frame, not yet in m_points
+    std::mt19937 m_feedRng;
+
+    bool m_polylineMode = false;
+    bool m_drawingPolyline = false;
+    MelkmanHull m_polylineHull;  // Hull of the polyline being drawn
+    void addPolylineVertex(const QPoint& point);
+
+    bool m_progressiveMode = false;
+    std::unique_ptr<ProgressiveHull> m_progressive;
+    QTimer *m_progressTimer;
+    QElapsedTimer m_progressClock;
+    int m_progressRevision = 0;
+    void stopProgressiveHull();
+
+    std::unique_ptr<KineticHull> m_kinetic;
+    QTimer *m_kineticTimer;
+    QElapsedTimer m_kineticClock;
+};
+
+#endif
@@ -0,0 +1,15 @@
+# Headless tools: sharded hulls, the regression gate and the hull service
+QT = core
+CONFIG += console c++17
+CONFIG -= app_bundle
+TARGET = convexilizer-cli
+
+include(../core/core.pri)
+
+SOURCES += \
+    main.cpp
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
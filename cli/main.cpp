@@ -0,0 +1,143 @@
+#include "hullservice.h"
+#include "melkmanhull.h"
+#include "regressiongate.h"
+#include "shardedhull.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <thread>
+
+// Headless mode: convexilizer-cli --shard-hull <points file> [--workers N]
+// Prints the hull vertices as "x y" lines, nothing of the GUI is started.
+static int runShardedHull(int argc, char *argv[])
+{
+    const char *path = nullptr;
+    int workers = static_cast<int>(std::thread::hardware_concurrency());
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--shard-hull") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (std::strcmp(argv[i], "--workers") == 0 && i + 1 < argc)
+            workers = std::atoi(argv[++i]);
+    }
+    if (!path) {
+        std::fprintf(stderr, "usage: %s --shard-hull <points file> [--workers N]\n", argv[0]);
+        return 2;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    ShardedHull sharded(workers);
+    if (!sharded.compute(QString::fromLocal8Bit(path))) {
+        std::fprintf(stderr, "%s\n", sharded.errorString().toLocal8Bit().constData());
+        return 1;
+    }
+    for (const QPoint &p : sharded.hull())
+        std::printf("%d %d\n", p.x(), p.y());
+    std::fprintf(stderr, "%lld points, %d hull vertices, %lld ms\n",
+                 static_cast<long long>(sharded.pointCount()), static_cast<int>(sharded.hull().size()),
+                 static_cast<long long>(timer.elapsed()));
+    return 0;
+}
+
+// Headless mode: convexilizer-cli --polyline-hull <polyline file> [--simple]
+// Streams the vertices of a polyline through Melkman's algorithm, so only the hull is held
+// in memory. --simple trusts the chain to be simple and skips the containment checks.
+static int runPolylineHull(int argc, char *argv[])
+{
+    const char *path = nullptr;
+    bool knownSimple = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--polyline-hull") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else if (std::strcmp(argv[i], "--simple") == 0)
+            knownSimple = true;
+    }
+    if (!path) {
+        std::fprintf(stderr, "usage: %s --polyline-hull <polyline file> [--simple]\n", argv[0]);
+        return 2;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    MelkmanHull melkman(knownSimple);
+    if (!melkman.readFile(QString::fromLocal8Bit(path))) {
+        std::fprintf(stderr, "%s\n", melkman.errorString().toLocal8Bit().constData());
+        return 1;
+    }
+    const QVector<QPoint> hull = melkman.hull();
+    for (const QPoint &p : hull)
+        std::printf("%d %d\n", p.x(), p.y());
+    std::fprintf(stderr, "%lld points, %d hull vertices, %lld ms\n",
+                 static_cast<long long>(melkman.pointCount()), static_cast<int>(hull.size()),
+                 static_cast<long long>(timer.elapsed()));
+    if (melkman.repairCount() > 0)
+        std::fprintf(stderr, "not a simple polyline, %d vertices needed a general hull step\n", melkman.repairCount());
+    return 0;
+}
+
+// Headless mode: convexilizer-cli --regression-gate [--baseline FILE] [--update-baseline]
+//                                [--threshold FRACTION] [--repetitions N]
+// Exits with 1 if any case regressed.
+static int runRegressionGate(int argc, char *argv[])
+{
+    RegressionGate::Options options;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+            options.baselinePath = QString::fromLocal8Bit(argv[++i]);
+        else if (std::strcmp(argv[i], "--update-baseline") == 0)
+            options.updateBaseline = true;
+        else if (std::strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+            options.threshold = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+    }
+    return RegressionGate(options).run() ? 0 : 1;
+}
+
+// Headless mode: convexilizer-cli --serve <socket path> [--threads N]
+// Answers hull requests on a Unix domain socket until interrupted, see HullService.
+static int runService(int argc, char *argv[])
+{
+    HullService::Options options;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--serve") == 0 && i + 1 < argc)
+            options.socketPath = QString::fromLocal8Bit(argv[++i]);
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            options.threads = std::max(1, std::atoi(argv[++i]));
+    }
+    if (options.socketPath.isEmpty()) {
+        std::fprintf(stderr, "usage: %s --serve <socket path> [--threads N]\n", argv[0]);
+        return 2;
+    }
+
+    HullService service(options);
+    if (!service.run()) {
+        std::fprintf(stderr, "%s\n", service.errorString().toLocal8Bit().constData());
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--shard-hull") == 0)
+            return runShardedHull(argc, argv);
+        if (std::strcmp(argv[i], "--polyline-hull") == 0)
+            return runPolylineHull(argc, argv);
+        if (std::strcmp(argv[i], "--regression-gate") == 0)
+            return runRegressionGate(argc, argv);
+        if (std::strcmp(argv[i], "--serve") == 0)
+            return runService(argc, argv);
+    }
+
+    std::fprintf(stderr, "usage: %s --shard-hull <points file> [--workers N]\n"
+                         "       %s --polyline-hull <polyline file> [--simple]\n"
+                         "       %s --regression-gate [--baseline FILE] [--update-baseline]"
+                         " [--threshold FRACTION] [--repetitions N]\n"
+                         "       %s --serve <socket path> [--threads N]\n", argv[0], argv[0], argv[0], argv[0]);
+    return 2;
+}
@@ -0,0 +1,96 @@
+#include "approximatehull.h"
+#include "hullutils.h"
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+ApproximateHull::ApproximateHull(const QVector<QPoint>& points, int strips)
+    : TracedHull(points), strips(std::max(1, strips)) {}
+
+template <typename Tracer>
+QVector<QPoint> ApproximateHull::run(Tracer& tracer) {
+    const int n = points.size();
+    const QPoint* data = points.constData();
+    bound = 0.0;
+    if (n < 3)
+        return HullUtils::monotoneChain(points);
+
+    const int threads = HullUtils::workerCount(n, ParallelThreshold);
+
+    // Pass 1: x range
+    std::vector<int> minX(threads, INT_MAX), maxX(threads, INT_MIN);
+    HullUtils::forSlices(n, threads, [&](int begin, int end, int t) {
+        int lo = INT_MAX, hi = INT_MIN;
+        for (int i = begin; i < end; i++) {
+            lo = std::min(lo, data[i].x());
+            hi = std::max(hi, data[i].x());
+        }
+        minX[t] = lo;
+        maxX[t] = hi;
+    });
+    const int left = *std::min_element(minX.begin(), minX.end());
+    const int right = *std::max_element(maxX.begin(), maxX.end());
+
+    // Pass 2: lowest and highest point of every strip. Strip 0 and the last strip also
+    // track the extreme x columns so the result spans the full x range.
+    const qint64 columns = static_cast<qint64>(right) - left + 1;
+    const int k = static_cast<int>(std::min<qint64>(strips, columns));
+    const int slots = k + 2;
+    std::vector<QPoint> low(static_cast<size_t>(threads) * slots, QPoint(0, INT_MAX));
+    std::vector<QPoint> high(static_cast<size_t>(threads) * slots, QPoint(0, INT_MIN));
+    HullUtils::forSlices(n, threads, [&](int begin, int end, int t) {
+        QPoint* lo = low.data() + static_cast<size_t>(t) * slots;
+        QPoint* hi = high.data() + static_cast<size_t>(t) * slots;
+        for (int i = begin; i < end; i++) {
+            const QPoint& p = data[i];
+            int s = static_cast<int>((static_cast<qint64>(p.x()) - left) * k / columns);
+            if (p.x() == left)
+                s = k;
+            else if (p.x() == right)
+                s = k + 1;
+            if (p.y() < lo[s].y())
+                lo[s] = p;
+            if (p.y() > hi[s].y())
+                hi[s] = p;
+        }
+    });
+
+    QVector<QPoint> candidates;
+    candidates.reserve(2 * slots);
+    for (int s = 0; s < slots; s++) {
+        QPoint lo(0, INT_MAX), hi(0, INT_MIN);
+        for (int t = 0; t < threads; t++) {
+            const QPoint& l = low[static_cast<size_t>(t) * slots + s];
+            const QPoint& h = high[static_cast<size_t>(t) * slots + s];
+            if (l.y() < lo.y())
+                lo = l;
+            if (h.y() > hi.y())
+                hi = h;
+        }
+        if (lo.y() != INT_MAX) {
+            tracer.test(lo, hi);
+            candidates.append(lo);
+            candidates.append(hi);
+        }
+    }
+
+    // A point between the lowest and highest point of its strip is at most one strip
+    // width away from the segment joining them
+    bound = static_cast<double>((columns + k - 1) / k);
+    if (k == columns)
+        bound = 0.0;
+
+    QVector<QPoint> hull = HullUtils::monotoneChain(candidates);
+    if constexpr (Tracer::enabled) {
+        for (int i = 0; i < hull.size(); i++)
+            tracer.accept(hull[i], hull[(i + 1) % hull.size()]);
+    }
+    return hull;
+}
+
+template QVector<QPoint> ApproximateHull::run(NullTracer& tracer);
+template QVector<QPoint> ApproximateHull::run(SteppingTracer& tracer);
+
+double ApproximateHull::errorBound() const {
+    return bound;
+}
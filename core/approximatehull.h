@@ -0,0 +1,34 @@
+#ifndef APPROXIMATEHULL_H
+#define APPROXIMATEHULL_H
+
+#include <QVector>
+#include <QPoint>
+
+#include "convexhull.h"
+
+// Bentley-Faust-Preparata approximate hull.
+// The x range is cut into vertical strips and only the lowest and highest point of each
+// strip is kept, so the work per point is constant and the final hull is built from at
+// most 2 * strips + 4 points. No input point lies further than one strip width outside
+// the result.
+class ApproximateHull : public TracedHull<ApproximateHull>
+{
+public:
+    ApproximateHull(const QVector<QPoint>& points, int strips = DefaultStrips);
+
+    // Instantiated for every tracer in approximatehull.cpp
+    template <typename Tracer>
+    QVector<QPoint> run(Tracer& tracer);
+
+    double errorBound() const override;
+
+    static constexpr int DefaultStrips = 1024;
+    // Inputs at least this large are bucketed on several threads
+    static constexpr int ParallelThreshold = 100'000;
+
+private:
+    int strips;
+    double bound = 0.0;
+};
+
+#endif // APPROXIMATEHULL_H
@@ -0,0 +1,259 @@
+#include "concavehull.h"
+#include "hullutils.h"
+#include "spatialgrid.h"
+#include <QHash>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+qint64 dot(const QPoint& a, const QPoint& b) {
+    return static_cast<qint64>(a.x()) * b.x() + static_cast<qint64>(a.y()) * b.y();
+}
+
+bool onSegment(const QPoint& a, const QPoint& b, const QPoint& p) {
+    return HullUtils::cross(a, b, p) == 0 &&
+           std::min(a.x(), b.x()) <= p.x() && p.x() <= std::max(a.x(), b.x()) &&
+           std::min(a.y(), b.y()) <= p.y() && p.y() <= std::max(a.y(), b.y());
+}
+
+// True if the closed segments a-b and c-d share a point
+bool segmentsIntersect(const QPoint& a, const QPoint& b, const QPoint& c, const QPoint& d) {
+    const qint64 d1 = HullUtils::cross(c, d, a);
+    const qint64 d2 = HullUtils::cross(c, d, b);
+    const qint64 d3 = HullUtils::cross(a, b, c);
+    const qint64 d4 = HullUtils::cross(a, b, d);
+    if (((d1 > 0 && d2 < 0) || (d1 < 0 && d2 > 0)) && ((d3 > 0 && d4 < 0) || (d3 < 0 && d4 > 0)))
+        return true;
+    return onSegment(c, d, a) || onSegment(c, d, b) || onSegment(a, b, c) || onSegment(a, b, d);
+}
+
+// Edges of the boundary walked so far, bucketed by the grid cells they pass through. Edge e runs from polygon[e] to polygon[e + 1].
+class EdgeIndex
+{
+public:
+    EdgeIndex(const SpatialGrid& grid, const QVector<QPoint>& polygon)
+        : grid(grid), polygon(polygon) {}
+
+    void insert(int edge) {
+        forCells(polygon[edge], polygon[edge + 1], [&](int cell) { cells[cell].append(edge); },
+                 [&]() { longEdges.append(edge); });
+    }
+
+    // True if a-b meets an edge other than skip1 and skip2. A single point a-a is tested
+    // for lying on an edge.
+    bool crosses(const QPoint& a, const QPoint& b, int skip1, int skip2) {
+        stamp++;
+        seen.resize(polygon.size());
+        bool hit = false;
+        auto test = [&](int edge) {
+            if (hit || edge == skip1 || edge == skip2 || seen[edge] == stamp)
+                return;
+            seen[edge] = stamp;
+            hit = segmentsIntersect(a, b, polygon[edge], polygon[edge + 1]);
+        };
+        for (int edge : longEdges)
+            test(edge);
+        forCells(a, b, [&](int cell) {
+            for (int edge : cells.value(cell))
+                test(edge);
+        }, [&]() {
+            for (int edge = 0; edge + 1 < polygon.size(); edge++)
+                test(edge);
+        });
+        return hit;
+    }
+
+private:
+    static constexpr int MaxCells = 256;
+
+    const SpatialGrid& grid;
+    const QVector<QPoint>& polygon;
+    QHash<int, QVector<int>> cells;
+    QVector<int> longEdges; // Edges passing through more than MaxCells cells
+    QVector<int> seen;
+    int stamp = 0;
+
+    // Calls cell() for every cell the segment a-b passes through, or tooMany() instead.
+    // Each column gets the rows the segment spans inside it, widened to whole rows.
+    template <typename Cell, typename TooMany>
+    void forCells(QPoint a, QPoint b, Cell cell, TooMany tooMany) const {
+        if (a.x() > b.x())
+            std::swap(a, b);
+        const int c0 = grid.column(a.x()), c1 = grid.column(b.x());
+        const int rows = std::abs(grid.row(a.y()) - grid.row(b.y()));
+        if (2 * (c1 - c0 + 1) + rows > MaxCells) {
+            tooMany();
+            return;
+        }
+        for (int c = c0; c <= c1; c++) {
+            int r0 = grid.row(std::min(a.y(), b.y())), r1 = grid.row(std::max(a.y(), b.y()));
+            if (a.x() != b.x()) {
+                const double slope = static_cast<double>(b.y() - a.y()) / (b.x() - a.x());
+                const double xl = std::max<double>(a.x(), grid.columnStart(c));
+                const double xr = std::min<double>(b.x(), grid.columnStart(c + 1));
+                const double yl = a.y() + slope * (xl - a.x());
+                const double yr = a.y() + slope * (xr - a.x());
+                r0 = grid.row(static_cast<int>(std::floor(std::min(yl, yr))));
+                r1 = grid.row(static_cast<int>(std::ceil(std::max(yl, yr))));
+            }
+            for (int r = r0; r <= r1; r++)
+                cell(r * grid.columns() + c);
+        }
+    }
+};
+
+// Walks the boundary with k neighbours. Returns false if the walk gets stuck.
+template <typename Tracer>
+bool walk(const QVector<QPoint>& points, const SpatialGrid& grid, int k, QVector<QPoint>& polygon,
+          Tracer& tracer) {
+    const int n = points.size();
+    int first = 0;
+    for (int i = 1; i < n; i++) {
+        if (points[i].y() < points[first].y() || (points[i].y() == points[first].y() && points[i].x() < points[first].x()))
+            first = i;
+    }
+
+    std::vector<char> visited(n, 0);
+    visited[first] = 1;
+    polygon = {points[first]};
+    EdgeIndex edges(grid, polygon);
+
+    auto fail = [&]() {
+        if constexpr (Tracer::enabled) {
+            for (int i = 0; i + 1 < polygon.size(); i++)
+                tracer.reject(polygon[i], polygon[i + 1]);
+        }
+        return false;
+    };
+
+    int current = first;
+    QPoint back(0, -1); // Direction to the previous vertex, as if the walk came up from below
+    while (polygon.size() <= n) {
+        // The first point may only be reached again once there is a triangle to close
+        if (polygon.size() == 3)
+            visited[first] = 0;
+
+        const QPoint origin = points[current];
+        QVector<int> candidates = grid.nearest(origin, k, [&](int i) { return !visited[i]; });
+
+        // Order by the counter-clockwise angle from the previous edge, so the sharpest
+        // right-hand turn comes first. Going straight back comes last.
+        auto group = [&](const QPoint& v) {
+            const qint64 turn = HullUtils::cross(QPoint(0, 0), back, v);
+            if (turn > 0)
+                return 0;
+            if (turn == 0 && dot(back, v) < 0)
+                return 1;
+            return turn < 0 ? 2 : 3;
+        };
+        std::stable_sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+            const QPoint va = points[a] - origin, vb = points[b] - origin;
+            const int ga = group(va), gb = group(vb);
+            if (ga != gb)
+                return ga < gb;
+            const qint64 turn = HullUtils::cross(QPoint(0, 0), va, vb);
+            if (turn != 0)
+                return turn > 0;
+            return dot(va, va) < dot(vb, vb);
+        });
+
+        const int lastEdge = polygon.size() - 2;
+        int next = -1;
+        for (int candidate : candidates) {
+            tracer.test(origin, points[candidate]);
+            const int closingEdge = candidate == first ? 0 : -1;
+            if (!edges.crosses(origin, points[candidate], lastEdge, closingEdge)) {
+                next = candidate;
+                break;
+            }
+        }
+        if (next < 0)
+            return fail();
+
+        tracer.accept(origin, points[next]);
+        if (next == first)
+            return true;
+
+        back = origin - points[next];
+        polygon.append(points[next]);
+        edges.insert(polygon.size() - 2);
+        visited[next] = 1;
+        current = next;
+    }
+    return fail();
+}
+
+// True if no point lies outside the closed polygon. Points on the boundary are found
+// through an EdgeIndex, the others by casting a ray towards +x across the edges bucketed
+// in their grid row. Horizontal edges never cross such a ray and are left out of the rows.
+bool enclosesAll(const QVector<QPoint>& points, const SpatialGrid& grid, const QVector<QPoint>& polygon) {
+    QVector<QPoint> closed = polygon;
+    closed.append(polygon.first());
+    EdgeIndex boundary(grid, closed);
+    QVector<QVector<int>> rows(grid.rows());
+    for (int e = 0; e < polygon.size(); e++) {
+        boundary.insert(e);
+        const QPoint& a = closed[e];
+        const QPoint& b = closed[e + 1];
+        if (a.y() == b.y())
+            continue;
+        const int y1 = grid.row(std::max(a.y(), b.y()));
+        for (int y = grid.row(std::min(a.y(), b.y())); y <= y1; y++)
+            rows[y].append(e);
+    }
+
+    for (const QPoint& p : points) {
+        if (boundary.crosses(p, p, -1, -1))
+            continue;
+        bool inside = false;
+        for (int e : rows[grid.row(p.y())]) {
+            const QPoint& a = closed[e];
+            const QPoint& b = closed[e + 1];
+            if ((a.y() > p.y()) != (b.y() > p.y())) {
+                const qint64 side = HullUtils::cross(a, b, p);
+                if (b.y() > a.y() ? side > 0 : side < 0)
+                    inside = !inside;
+            }
+        }
+        if (!inside)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+ConcaveHull::ConcaveHull(const QVector<QPoint>& points, int k)
+    : TracedHull(points), neighbours(std::max(MinNeighbours, k)) {}
+
+template <typename Tracer>
+QVector<QPoint> ConcaveHull::run(Tracer& tracer) {
+    QVector<QPoint> unique = points;
+    std::sort(unique.begin(), unique.end(), HullUtils::lessXY);
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+    const int n = unique.size();
+
+    QVector<QPoint> convex = HullUtils::monotoneChainSorted(unique);
+    if (convex.size() >= 3 && n > 3) {
+        SpatialGrid grid(unique);
+        // Each retry widens the neighbourhood by half, so the number of walks stays
+        // logarithmic in the k that finally works. Sets that need more than
+        // MaxNeighbours, like well separated clusters, get their convex hull.
+        for (int k = neighbours; k < n && k <= MaxNeighbours; k += std::max(1, k / 2)) {
+            QVector<QPoint> polygon;
+            if (walk(unique, grid, k, polygon, tracer) && enclosesAll(unique, grid, polygon))
+                return polygon;
+        }
+    }
+
+    if constexpr (Tracer::enabled) {
+        for (int i = 0; i < convex.size(); i++)
+            tracer.accept(convex[i], convex[(i + 1) % convex.size()]);
+    }
+    return convex;
+}
+
+template QVector<QPoint> ConcaveHull::run(NullTracer& tracer);
+template QVector<QPoint> ConcaveHull::run(SteppingTracer& tracer);
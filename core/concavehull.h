@@ -0,0 +1,33 @@
+#ifndef CONCAVEHULL_H
+#define CONCAVEHULL_H
+
+#include <QVector>
+#include <QPoint>
+
+#include "convexhull.h"
+
+// Concave hull by k-nearest neighbour chaining (Moreira and Santos).
+// Starting at the lowest point, the boundary walks to whichever of its k nearest unvisited
+// neighbours makes the sharpest right-hand turn without crossing the boundary so far. If
+// the walk gets stuck or leaves points outside, it is repeated with more neighbours,
+// falling back to the convex hull. Neighbours come from a SpatialGrid and edges are looked up in a
+// grid as well, so a walk costs about O(n + h k log k).
+class ConcaveHull : public TracedHull<ConcaveHull>
+{
+public:
+    // Smaller k follows the points more closely
+    ConcaveHull(const QVector<QPoint>& points, int k = DefaultNeighbours);
+
+    // Instantiated for every tracer in concavehull.cpp
+    template <typename Tracer>
+    QVector<QPoint> run(Tracer& tracer);
+
+    static constexpr int DefaultNeighbours = 10;
+    static constexpr int MinNeighbours = 3;
+    static constexpr int MaxNeighbours = 512;
+
+private:
+    int neighbours;
+};
+
+#endif // CONCAVEHULL_H
@@ -0,0 +1,114 @@
+#ifndef CONVEXHULL_H
+#define CONVEXHULL_H
+
+#include <QVector>
+#include <QPoint>
+#include <QDebug>
+#include <functional>
+
+
+// Animation brush
+using LineBrush = std::function<void(const QPoint&, const QPoint&)>;
+
+// One visual step of a hull computation
+struct HullStep {
+    enum class Kind {
+        Test,   // Edge being examined
+        Accept, // Edge added to the hull built so far
+        Reject  // Previously accepted edge taken out again
+    };
+    Kind kind;
+    QPoint from;
+    QPoint to;
+};
+
+// Tracer policies. Every algorithm is written once as run<Tracer>() and reports its steps
+// to the tracer. NullTracer's members are empty inline functions, so compute() compiles to
+// the same code as an untraced implementation.
+struct NullTracer {
+    static constexpr bool enabled = false;
+    void test(const QPoint&, const QPoint&) {}
+    void accept(const QPoint&, const QPoint&) {}
+    void reject(const QPoint&, const QPoint&) {}
+};
+
+// Hands every step to a callback as it happens, so nothing is stored. HullStepper uses it
+// to run an algorithm as a generator.
+struct SteppingTracer {
+    static constexpr bool enabled = true;
+    std::function<void(const HullStep&)> yield;
+    void test(const QPoint& from, const QPoint& to) { yield(HullStep{HullStep::Kind::Test, from, to}); }
+    void accept(const QPoint& from, const QPoint& to) { yield(HullStep{HullStep::Kind::Accept, from, to}); }
+    void reject(const QPoint& from, const QPoint& to) { yield(HullStep{HullStep::Kind::Reject, from, to}); }
+};
+
+class ConvexHull {
+public:
+    ConvexHull(const QVector<QPoint> &points, const LineBrush hullBrush = nullptr, const LineBrush &stepBrush = nullptr, const LineBrush &clearBrush = nullptr) : points(points), hull_brush(hullBrush), step_brush(stepBrush), clear_brush(clearBrush) {}
+    virtual ~ConvexHull() {}
+
+    // Compute the convex hull
+    virtual QVector<QPoint> compute() = 0;
+    // Same as compute() but reports every step to the tracer as it happens
+    virtual QVector<QPoint> compute_stepped(SteppingTracer& tracer) = 0;
+
+    // Largest distance an input point can lie outside the computed hull, 0 for exact algorithms
+    virtual double errorBound() const {
+        return 0.0;
+    }
+
+    QVector<QPoint> get_hull() const {
+        return current_hull;
+    }
+
+    void setHullBrush(LineBrush &brush) {
+        this->hull_brush = brush;
+    }
+
+    void setStepBrush(LineBrush &brush) {
+        this->step_brush = brush;
+    }
+
+    void setClearBrush(LineBrush &brush) {
+        this->clear_brush = brush;
+    }
+
+    void clearTrialSteps() {
+        if (clear_brush) {
+            // Erase each line segment formed by consecutive points in hull_step
+            for (int i = 0; i < hull_step.size() - 1; i++) {
+                step_brush(hull_step[i], hull_step[i+1]); // Assuming step_brush can also "erase" lines
+            }
+        } else {
+            qDebug() << "WARNING: Clear brush was not provided!";
+        }
+        hull_step.clear(); // Clear the stored step points
+    }
+
+protected:
+    QVector<QPoint> points;
+    QVector<QPoint> current_hull;
+    QVector<QPoint> hull_step; // Trial step points, this is used to clear those lines
+    LineBrush hull_brush; // Final hull line
+    LineBrush step_brush; // Trial step line
+    LineBrush clear_brush; // Brush for removing drawn lines
+
+};
+
+// Implements compute() and compute_stepped() on top of Derived::run<Tracer>()
+template <typename Derived>
+class TracedHull : public ConvexHull {
+public:
+    using ConvexHull::ConvexHull;
+
+    QVector<QPoint> compute() override {
+        NullTracer tracer;
+        return static_cast<Derived*>(this)->run(tracer);
+    }
+
+    QVector<QPoint> compute_stepped(SteppingTracer& tracer) override {
+        return static_cast<Derived*>(this)->run(tracer);
+    }
+};
+
+#endif // CONVEXHULL_H
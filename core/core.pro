@@ -0,0 +1,56 @@
+# Hull algorithms and headless services, without QtGui or QtWidgets
+TEMPLATE = lib
+CONFIG += staticlib c++17
+QT = core
+TARGET = convexilizercore
+
+SOURCES += \
+    approximatehull.cpp \
+    concavehull.cpp \
+    convexhull.cpp \
+    grahamscan.cpp \
+    hullalgorithms.cpp \
+    hullcore.cpp \
+    hullservice.cpp \
+    hullstepper.cpp \
+    hullwire.cpp \
+    jarvismarch.cpp \
+    kinetichull.cpp \
+    melkmanhull.cpp \
+    mergehull.cpp \
+    parallelgrahamscan.cpp \
+    pointgenerator.cpp \
+    progressivehull.cpp \
+    quickhull.cpp \
+    quickhull3d.cpp \
+    regressiongate.cpp \
+    rotatingcalipers.cpp \
+    shardedhull.cpp \
+    slidingwindowhull.cpp \
+    spatialgrid.cpp
+
+HEADERS += \
+    approximatehull.h \
+    concavehull.h \
+    convexhull.h \
+    grahamscan.h \
+    hullalgorithms.h \
+    hullcore.h \
+    hullservice.h \
+    hullstepper.h \
+    hullutils.h \
+    hullwire.h \
+    jarvismarch.h \
+    kinetichull.h \
+    melkmanhull.h \
+    mergehull.h \
+    parallelgrahamscan.h \
+    pointgenerator.h \
+    progressivehull.h \
+    quickhull.h \
+    quickhull3d.h \
+    regressiongate.h \
+    rotatingcalipers.h \
+    shardedhull.h \
+    slidingwindowhull.h \
+    spatialgrid.h
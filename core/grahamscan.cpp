@@ -0,0 +1,4 @@
+#include "grahamscan.h"
+
+GrahamScan::GrahamScan(const QVector<QPoint>& points)
+    : TracedHull(points) {}
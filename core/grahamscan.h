@@ -0,0 +1,57 @@
+#ifndef GRAHAMSCAN_H
+#define GRAHAMSCAN_H
+
+#include <QVector>
+#include <QPoint>
+#include <algorithm>
+
+#include "convexhull.h"
+#include "hullutils.h"
+
+// Graham scan in Andrew's monotone chain form: sort by x, then build the lower and upper
+// chains with a stack, popping points that do not make a left turn.
+class GrahamScan : public TracedHull<GrahamScan> {
+public:
+    GrahamScan(const QVector<QPoint>& points);
+
+    template <typename Tracer>
+    QVector<QPoint> run(Tracer& tracer);
+};
+
+template <typename Tracer>
+QVector<QPoint> GrahamScan::run(Tracer& tracer) {
+    std::sort(points.begin(), points.end(), HullUtils::lessXY);
+
+    int n = points.size();
+    if (n < 3)
+        return HullUtils::monotoneChainSorted(points);
+
+    QVector<QPoint> hull(2 * n);
+    int k = 0;
+    auto scan = [&](int i, int lowest) {
+        const QPoint& p = points[i];
+        if (k > 0)
+            tracer.test(hull[k - 1], p);
+        while (k >= lowest && HullUtils::cross(hull[k - 2], hull[k - 1], p) <= 0) {
+            tracer.reject(hull[k - 2], hull[k - 1]);
+            k--;
+        }
+        if (k > 0)
+            tracer.accept(hull[k - 1], p);
+        hull[k++] = p;
+    };
+
+    // Lower chain, left to right
+    for (int i = 0; i < n; i++)
+        scan(i, 2);
+    // Upper chain, right to left
+    for (int i = n - 2, lowest = k + 1; i >= 0; i--)
+        scan(i, lowest);
+
+    hull.resize(k - 1); // Last point repeats the first
+    if (hull.size() == 2 && hull[0] == hull[1])
+        hull.resize(1);
+    return hull;
+}
+
+#endif // GRAHAMSCAN_H
@@ -0,0 +1,38 @@
+#include "hullalgorithms.h"
+#include "grahamscan.h"
+#include "quickhull.h"
+#include "jarvismarch.h"
+#include "mergehull.h"
+#include "approximatehull.h"
+#include "parallelgrahamscan.h"
+#include "concavehull.h"
+
+ConvexHull* createHull(HullAlgorithm algorithm, const QVector<QPoint>& points) {
+    switch (algorithm) {
+    case HullAlgorithm::G: return new GrahamScan(points);
+    case HullAlgorithm::J: return new JarvisMarch(points);
+    case HullAlgorithm::Q: return new QuickHull(points);
+    case HullAlgorithm::M: return new MergeHull(points);
+    case HullAlgorithm::A: return new ApproximateHull(points);
+    case HullAlgorithm::P: return new ParallelGrahamScan(points);
+    case HullAlgorithm::C: return new ConcaveHull(points);
+    }
+    return nullptr;
+}
+
+QString hullAlgorithmName(HullAlgorithm algorithm) {
+    switch (algorithm) {
+    case HullAlgorithm::G: return "Graham Scan";
+    case HullAlgorithm::J: return "Jarvis March";
+    case HullAlgorithm::Q: return "QuickHull";
+    case HullAlgorithm::M: return "Merge Hull";
+    case HullAlgorithm::A: return "Approximate Hull";
+    case HullAlgorithm::P: return "Parallel Graham Scan";
+    case HullAlgorithm::C: return "Concave Hull";
+    }
+    return QString();
+}
+
+bool isExactHull(HullAlgorithm algorithm) {
+    return algorithm != HullAlgorithm::A && algorithm != HullAlgorithm::C;
+}
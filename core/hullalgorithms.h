@@ -0,0 +1,21 @@
+#ifndef HULLALGORITHMS_H
+#define HULLALGORITHMS_H
+
+#include <QVector>
+#include <QPoint>
+#include <QString>
+
+#include "convexhull.h"
+
+// The 2D hull algorithms by name, for the GUI, benchmarks and headless tools.
+// C is the concave hull and is left out of the convex hull checks.
+enum class HullAlgorithm { G, J, Q, M, A, P, C };
+
+// Caller owns the returned object
+ConvexHull* createHull(HullAlgorithm algorithm, const QVector<QPoint>& points);
+QString hullAlgorithmName(HullAlgorithm algorithm);
+
+// True for algorithms whose result must match the exact hull
+bool isExactHull(HullAlgorithm algorithm);
+
+#endif // HULLALGORITHMS_H
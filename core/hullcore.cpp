@@ -0,0 +1,25 @@
+#include "hullcore.h"
+#include "convexhull.h"
+
+namespace HullCore {
+
+int computeHull(HullAlgorithm algorithm, const qint32* xy, int count, qint32* hull) {
+    if (count <= 0)
+        return 0;
+
+    QVector<QPoint> points(count);
+    for (int i = 0; i < count; i++)
+        points[i] = QPoint(xy[2 * i], xy[2 * i + 1]);
+
+    ConvexHull* hullAlgorithm = createHull(algorithm, points);
+    const QVector<QPoint> result = hullAlgorithm->compute();
+    delete hullAlgorithm;
+
+    for (int i = 0; i < result.size(); i++) {
+        hull[2 * i] = result[i].x();
+        hull[2 * i + 1] = result[i].y();
+    }
+    return result.size();
+}
+
+} // namespace HullCore
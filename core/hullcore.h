@@ -0,0 +1,19 @@
+#ifndef HULLCORE_H
+#define HULLCORE_H
+
+#include <QtGlobal>
+
+#include "hullalgorithms.h"
+
+// Contiguous buffer interface to the hull algorithms, for callers that keep their points
+// in plain arrays. Points are interleaved qint32 x, y pairs.
+namespace HullCore {
+
+// Writes the hull of count points to hull, which needs room for count pairs, and returns
+// the number of hull vertices. Exact algorithms return them counter-clockwise from the
+// lowest x.
+int computeHull(HullAlgorithm algorithm, const qint32* xy, int count, qint32* hull);
+
+} // namespace HullCore
+
+#endif // HULLCORE_H
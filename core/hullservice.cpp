@@ -0,0 +1,340 @@
+#include "hullservice.h"
+#include "hullutils.h"
+#include "hullwire.h"
+#include "parallelgrahamscan.h"
+#include <QtGlobal>
+#include <QByteArray>
+#include <QDebug>
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+
+#ifdef Q_OS_LINUX
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+volatile std::sig_atomic_t stopRequested = 0;
+
+void requestStop(int) {
+    stopRequested = 1;
+}
+
+qint64 nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Header, then the hull in the HullWire layout
+void appendResponse(QVector<qint32>& message, quint32 id, quint32 status, const QVector<QPoint>& hull) {
+    message.append(static_cast<qint32>(id));
+    message.append(static_cast<qint32>(status));
+    message.append(static_cast<qint32>(hull.size()));
+    for (const QPoint& p : hull) {
+        message.append(p.x());
+        message.append(p.y());
+    }
+}
+
+} // namespace
+
+HullService::HullService(const Options& options)
+    : options(options) {
+    this->options.threads = std::max(1, options.threads);
+    this->options.batchSize = std::max(1, options.batchSize);
+}
+
+HullService::~HullService() = default;
+
+QString HullService::errorString() const {
+    return error;
+}
+
+void HullService::Histogram::record(qint64 ns) {
+    quint64 us = static_cast<quint64>(std::max<qint64>(0, ns / 1000));
+    int bucket = 0;
+    while (us > 0 && bucket + 1 < static_cast<int>(buckets.size())) {
+        us >>= 1;
+        bucket++;
+    }
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+QString HullService::Histogram::report(const QString& name) const {
+    std::array<quint64, 40> counts;
+    quint64 total = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        counts[i] = buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0)
+        return QString("%1: no requests\n").arg(name);
+
+    // Percentiles are reported as the upper end of their bucket
+    auto percentile = [&](double fraction) {
+        quint64 rank = static_cast<quint64>(fraction * (total - 1)) + 1;
+        quint64 seen = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            seen += counts[i];
+            if (seen >= rank)
+                return quint64(1) << i;
+        }
+        return quint64(1) << (counts.size() - 1);
+    };
+    QString text = QString("%1: %2 requests, p50 < %3 us, p90 < %4 us, p99 < %5 us, max < %6 us\n")
+                       .arg(name).arg(total).arg(percentile(0.5)).arg(percentile(0.9))
+                       .arg(percentile(0.99)).arg(percentile(1.0));
+    for (size_t i = 0; i < counts.size(); i++) {
+        if (counts[i] > 0)
+            text += QString("  < %1 us: %2\n").arg(quint64(1) << i, 10).arg(counts[i]);
+    }
+    return text;
+}
+
+QString HullService::latencyReport() const {
+    return smallLatency.report("Batched") + largeLatency.report("Parallel");
+}
+
+QVector<QPoint> HullService::computeHull(quint32 algorithm, const QVector<QPoint>& points, int threads,
+                                         quint32& status) {
+    if (algorithm > static_cast<quint32>(HullAlgorithm::C)) {
+        status = BadAlgorithm;
+        return QVector<QPoint>();
+    }
+    status = Ok;
+    HullAlgorithm which = static_cast<HullAlgorithm>(algorithm);
+    // Exact algorithms all return the same vertices, so large inputs use the fastest one
+    if (threads > 1 && isExactHull(which))
+        return ParallelGrahamScan(points, threads).compute();
+    ConvexHull* hull = createHull(which, points);
+    QVector<QPoint> result = hull->compute();
+    delete hull;
+    return result;
+}
+
+void HullService::respond(std::vector<Job>& jobs) {
+    // One message per connection for the whole batch
+    std::vector<std::pair<Connection*, QVector<qint32>>> messages;
+    for (Job& job : jobs) {
+        quint32 status = Ok;
+        QVector<QPoint> hull = computeHull(job.algorithm, job.points, 1, status);
+        auto it = std::find_if(messages.begin(), messages.end(), [&](const auto& message) {
+            return message.first == job.connection.get();
+        });
+        if (it == messages.end()) {
+            messages.emplace_back(job.connection.get(), QVector<qint32>());
+            it = messages.end() - 1;
+        }
+        appendResponse(it->second, job.id, status, hull);
+    }
+
+    for (auto& message : messages) {
+        std::lock_guard<std::mutex> lock(message.first->writeLock);
+        HullWire::writeAll(message.first->fd, message.second.constData(), message.second.size() * sizeof(qint32));
+    }
+    const qint64 done = nowNs();
+    for (const Job& job : jobs)
+        smallLatency.record(done - job.receivedNs);
+}
+
+void HullService::respondLarge(Job& job, int threads) {
+    quint32 status = Ok;
+    QVector<QPoint> hull = computeHull(job.algorithm, job.points, threads, status);
+    QVector<qint32> message;
+    appendResponse(message, job.id, status, hull);
+    {
+        std::lock_guard<std::mutex> lock(job.connection->writeLock);
+        HullWire::writeAll(job.connection->fd, message.constData(), message.size() * sizeof(qint32));
+    }
+    largeLatency.record(nowNs() - job.receivedNs);
+}
+
+void HullService::workerLoop() {
+    std::vector<Job> batch;
+    while (true) {
+        Job large;
+        int threads = 1;
+        {
+            std::unique_lock<std::mutex> lock(queueLock);
+            // One thread is kept from large requests, so small ones never wait behind them
+            auto largeIdle = [this] { return options.threads - busyThreads - (options.threads > 1 ? 1 : 0); };
+            queueReady.wait(lock, [&] {
+                return stopping || (!queue.empty() && busyThreads < options.threads) ||
+                       (!largeQueue.empty() && largeIdle() > 0);
+            });
+            if (queue.empty() && largeQueue.empty())
+                return;
+            if (!largeQueue.empty() && (largeIdle() > 0 || queue.empty())) {
+                // A large request takes the idle threads
+                large = std::move(largeQueue.front());
+                largeQueue.pop_front();
+                threads = std::max(1, largeIdle());
+            } else {
+                // Share a backlog between the workers instead of letting one take all of it
+                int share = static_cast<int>((queue.size() + options.threads - 1) / options.threads);
+                int take = std::min(options.batchSize, share);
+                for (int i = 0; i < take; i++) {
+                    batch.push_back(std::move(queue.front()));
+                    queue.pop_front();
+                }
+            }
+            busyThreads += threads;
+        }
+        if (large.connection)
+            respondLarge(large, threads);
+        else
+            respond(batch);
+        batch.clear();
+        {
+            std::lock_guard<std::mutex> lock(queueLock);
+            busyThreads -= threads;
+        }
+        queueReady.notify_all();
+    }
+}
+
+#ifdef Q_OS_LINUX
+
+HullService::Connection::~Connection() {
+    ::close(fd);
+}
+
+void HullService::serveConnection(std::shared_ptr<Connection> connection) {
+    while (true) {
+        quint32 header[2];
+        quint32 count = 0;
+        if (!HullWire::readAll(connection->fd, header, sizeof(header)) || !HullWire::readCount(connection->fd, count))
+            break;
+        if (count > HullWire::MaxPoints) {
+            QVector<qint32> message;
+            appendResponse(message, header[0], TooLarge, QVector<QPoint>());
+            std::lock_guard<std::mutex> lock(connection->writeLock);
+            HullWire::writeAll(connection->fd, message.constData(), message.size() * sizeof(qint32));
+            break;
+        }
+        QVector<QPoint> points;
+        if (!HullWire::readPoints(connection->fd, count, points))
+            break;
+        const qint64 received = nowNs();
+
+        if (header[1] == StatsRequest) {
+            QByteArray text = latencyReport().toUtf8();
+            quint32 reply[3] = {header[0], Stats, static_cast<quint32>(text.size())};
+            std::lock_guard<std::mutex> lock(connection->writeLock);
+            HullWire::writeAll(connection->fd, reply, sizeof(reply));
+            HullWire::writeAll(connection->fd, text.constData(), static_cast<std::size_t>(text.size()));
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queueLock);
+            std::deque<Job>& lane = points.size() > options.smallLimit ? largeQueue : queue;
+            lane.push_back(Job{connection, header[0], header[1], std::move(points), received});
+        }
+        queueReady.notify_one();
+    }
+    connection->closed = true;
+}
+
+bool HullService::run() {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    QByteArray path = options.socketPath.toLocal8Bit();
+    if (path.isEmpty() || path.size() >= static_cast<int>(sizeof(address.sun_path))) {
+        error = QString("Invalid socket path %1").arg(options.socketPath);
+        return false;
+    }
+    std::copy(path.constData(), path.constData() + path.size(), address.sun_path);
+
+    listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ::unlink(path.constData());
+    if (listener < 0 || ::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener, 128) != 0) {
+        error = QString("Cannot listen on %1").arg(options.socketPath);
+        if (listener >= 0)
+            ::close(listener);
+        listener = -1;
+        return false;
+    }
+
+    std::signal(SIGPIPE, SIG_IGN); // Clients that hang up only fail their own writes
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+    qInfo().noquote() << "Serving hulls on" << options.socketPath << "with" << options.threads << "threads";
+
+    for (int t = 0; t < options.threads; t++)
+        workers.emplace_back(&HullService::workerLoop, this);
+
+    std::vector<std::pair<std::thread, std::shared_ptr<Connection>>> readers;
+    while (!stopRequested) {
+        // Wake up regularly to notice a stop request
+        pollfd waiting{listener, POLLIN, 0};
+        if (::poll(&waiting, 1, 200) <= 0)
+            continue;
+        int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0)
+            continue;
+
+        // Join the readers of connections that have ended
+        for (auto it = readers.begin(); it != readers.end();) {
+            if (it->second->closed) {
+                it->first.join();
+                it = readers.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        auto connection = std::make_shared<Connection>();
+        connection->fd = fd;
+        readers.emplace_back(std::thread(&HullService::serveConnection, this, connection), connection);
+    }
+
+    ::close(listener);
+    ::unlink(path.constData());
+    for (auto& reader : readers) {
+        ::shutdown(reader.second->fd, SHUT_RDWR);
+        reader.first.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(queueLock);
+        stopping = true;
+    }
+    queueReady.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+    workers.clear();
+
+    qInfo().noquote() << latencyReport();
+    return true;
+}
+
+bool HullService::request(int fd, HullAlgorithm algorithm, const QVector<QPoint>& points, QVector<QPoint>& hull) {
+    quint32 header[2] = {0, static_cast<quint32>(algorithm)};
+    if (!HullWire::writeAll(fd, header, sizeof(header)) || !HullWire::writeHull(fd, points))
+        return false;
+    quint32 reply[2];
+    if (!HullWire::readAll(fd, reply, sizeof(reply)))
+        return false;
+    return HullWire::readHull(fd, hull) && reply[1] == Ok;
+}
+
+#else
+
+HullService::Connection::~Connection() {}
+
+void HullService::serveConnection(std::shared_ptr<Connection>) {}
+
+bool HullService::run() {
+    error = "The hull service needs Linux";
+    return false;
+}
+
+bool HullService::request(int, HullAlgorithm, const QVector<QPoint>&, QVector<QPoint>&) {
+    return false;
+}
+
+#endif
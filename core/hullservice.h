@@ -0,0 +1,110 @@
+#ifndef HULLSERVICE_H
+#define HULLSERVICE_H
+
+#include <QVector>
+#include <QPoint>
+#include <QString>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "hullalgorithms.h"
+
+// Headless hull daemon on a Unix domain socket. Linux only.
+//
+// Every message starts with a header of two quint32 values in host byte order, followed
+// by a point list in the HullWire format:
+//   request:  id, algorithm (a HullAlgorithm value), points
+//   response: id, status, hull
+// Responses carry the id of their request and may arrive out of order. Sending
+// StatsRequest as the algorithm returns the latency report as status Stats, followed by
+// a quint32 byte count and the UTF-8 text instead of a hull. A request of more than
+// HullWire::MaxPoints points is answered with status TooLarge and an empty hull, and
+// the connection is closed since the rest of the request is never read.
+//
+// Small requests are queued for a pool of worker threads, each of which takes a whole
+// batch off the queue at once and writes the answers per connection in one go. Large
+// requests go to the same pool on a queue of their own and are computed with the
+// parallel Graham scan on the idle threads of the pool, less one kept for small requests.
+// The reader thread keeps reading meanwhile, and no more than Options::threads threads
+// compute hulls at any time.
+class HullService
+{
+public:
+    struct Options {
+        QString socketPath;
+        int threads = static_cast<int>(std::thread::hardware_concurrency());
+        int smallLimit = 4096;  // Requests with more points bypass the queue
+        int batchSize = 64;     // Most requests a worker takes off the queue at once
+    };
+
+    enum Status : quint32 { Ok = 0, BadAlgorithm = 1, Stats = 2, TooLarge = 3 };
+    static constexpr quint32 StatsRequest = 0xffffffff;
+
+    HullService(const Options& options);
+    ~HullService();
+
+    // Serves until SIGINT or SIGTERM, then prints the latency report to stderr
+    bool run();
+    QString errorString() const;
+
+    // Latency from a request being read to its response being written
+    QString latencyReport() const;
+
+    // Client side: computes one hull over an open connection to the service
+    static bool request(int fd, HullAlgorithm algorithm, const QVector<QPoint>& points, QVector<QPoint>& hull);
+
+private:
+    struct Connection {
+        int fd = -1;
+        std::mutex writeLock;
+        std::atomic<bool> closed{false}; // Set when the reader thread is done
+        ~Connection();
+    };
+
+    struct Job {
+        std::shared_ptr<Connection> connection;
+        quint32 id;
+        quint32 algorithm;
+        QVector<QPoint> points;
+        qint64 receivedNs;
+    };
+
+    // Power of two buckets of microseconds
+    class Histogram {
+    public:
+        void record(qint64 ns);
+        QString report(const QString& name) const;
+    private:
+        std::array<std::atomic<quint64>, 40> buckets{};
+    };
+
+    Options options;
+    QString error;
+    int listener = -1;
+
+    std::mutex queueLock;
+    std::condition_variable queueReady;
+    std::deque<Job> queue;
+    std::deque<Job> largeQueue;
+    int busyThreads = 0;  // Threads computing hulls, at most options.threads
+    bool stopping = false;
+    std::vector<std::thread> workers;
+
+    Histogram smallLatency;
+    Histogram largeLatency;
+
+    void serveConnection(std::shared_ptr<Connection> connection);
+    void workerLoop();
+    void respond(std::vector<Job>& jobs);
+    void respondLarge(Job& job, int threads);
+    // threads > 1 runs exact algorithms with the parallel Graham scan on that many threads
+    static QVector<QPoint> computeHull(quint32 algorithm, const QVector<QPoint>& points, int threads, quint32& status);
+};
+
+#endif // HULLSERVICE_H
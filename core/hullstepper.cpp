@@ -0,0 +1,81 @@
+#include "hullstepper.h"
+#include <QElapsedTimer>
+
+HullStepper::HullStepper(ConvexHull* algorithm)
+    : algorithm(algorithm) {
+    worker = std::thread(&HullStepper::run, this);
+}
+
+HullStepper::~HullStepper() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        cancelled = true;
+    }
+    changed.notify_all();
+    worker.join();
+}
+
+void HullStepper::run() {
+    SteppingTracer tracer;
+    tracer.yield = [this](const HullStep& step) { yield(step); };
+    QVector<QPoint> result;
+    QElapsedTimer timer;
+    timer.start();
+    try {
+        result = algorithm->compute_stepped(tracer);
+    } catch (const Cancelled&) {
+    }
+    const qint64 elapsedNs = timer.nsecsElapsed();
+
+    std::lock_guard<std::mutex> guard(lock);
+    hull = result;
+    runtimeNs = elapsedNs - blockedNs;
+    done = true;
+    changed.notify_all();
+}
+
+void HullStepper::yield(const HullStep& step) {
+    std::unique_lock<std::mutex> guard(lock);
+    if (!cancelled && static_cast<int>(pending.size()) >= Lookahead) {
+        QElapsedTimer blocked;
+        blocked.start();
+        changed.wait(guard, [this] { return cancelled || static_cast<int>(pending.size()) < Lookahead; });
+        blockedNs += blocked.nsecsElapsed();
+    }
+    // Unwinds the algorithm back to run()
+    if (cancelled)
+        throw Cancelled();
+    pending.push_back(step);
+    changed.notify_all();
+}
+
+bool HullStepper::next(HullStep& step) {
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait(guard, [this] { return done || !pending.empty(); });
+    if (pending.empty())
+        return false;
+    step = pending.front();
+    pending.pop_front();
+    changed.notify_all();
+    return true;
+}
+
+HullStepper::Poll HullStepper::tryNext(HullStep& step) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (pending.empty())
+        return done ? Poll::Finished : Poll::NotReady;
+    step = pending.front();
+    pending.pop_front();
+    changed.notify_all();
+    return Poll::Step;
+}
+
+QVector<QPoint> HullStepper::result() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return hull;
+}
+
+qint64 HullStepper::runtimeMs() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return runtimeNs / 1'000'000;
+}
@@ -0,0 +1,60 @@
+#ifndef HULLSTEPPER_H
+#define HULLSTEPPER_H
+
+#include <QVector>
+#include <QPoint>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "convexhull.h"
+
+// Runs a hull algorithm as a generator of its visual steps.
+//
+// The algorithm runs on its own thread with a SteppingTracer and may only get Lookahead
+// steps ahead of the consumer before it blocks, so memory stays constant however long
+// the run is. Destroying the stepper cancels a run that has not finished.
+class HullStepper
+{
+public:
+    // The algorithm is not owned and must outlive the stepper
+    HullStepper(ConvexHull* algorithm);
+    ~HullStepper();
+
+    // Takes the next step of the run. Returns false once the run is over.
+    bool next(HullStep& step);
+
+    // Same as next() without waiting: NotReady while the algorithm is busy in a phase
+    // that reports no steps, such as a sort
+    enum class Poll { Step, NotReady, Finished };
+    Poll tryNext(HullStep& step);
+
+    // The hull, valid once next() has returned false
+    QVector<QPoint> result() const;
+    // Time the algorithm ran, not counting the time it waited for the consumer. Valid
+    // once next() has returned false.
+    qint64 runtimeMs() const;
+
+    static constexpr int Lookahead = 1024;
+
+private:
+    struct Cancelled {};
+
+    ConvexHull* algorithm;
+    std::thread worker;
+
+    mutable std::mutex lock;
+    std::condition_variable changed;
+    std::deque<HullStep> pending;
+    QVector<QPoint> hull;
+    qint64 runtimeNs = 0;
+    qint64 blockedNs = 0;  // Only touched by the worker until done
+    bool done = false;
+    bool cancelled = false;
+
+    void run();
+    void yield(const HullStep& step);
+};
+
+#endif // HULLSTEPPER_H
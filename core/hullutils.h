@@ -0,0 +1,172 @@
+#ifndef HULLUTILS_H
+#define HULLUTILS_H
+
+#include <QVector>
+#include <QPoint>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// Small geometry helpers shared by the hull algorithms
+namespace HullUtils {
+
+// Cross product of (a - o) and (b - o), positive if o, a, b turn counter-clockwise
+inline qint64 cross(const QPoint& o, const QPoint& a, const QPoint& b) {
+    return static_cast<qint64>(a.x() - o.x()) * (b.y() - o.y()) -
+           static_cast<qint64>(a.y() - o.y()) * (b.x() - o.x());
+}
+
+// Lexicographic order by x, then y
+inline bool lessXY(const QPoint& a, const QPoint& b) {
+    return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+}
+
+// Andrew's monotone chain over points already sorted with lessXY.
+// Returns the hull counter-clockwise from the lowest x, without duplicate or collinear points.
+inline QVector<QPoint> monotoneChainSorted(const QVector<QPoint>& sorted) {
+    int n = sorted.size();
+    if (n < 3) {
+        QVector<QPoint> hull(sorted);
+        hull.erase(std::unique(hull.begin(), hull.end()), hull.end());
+        return hull;
+    }
+
+    QVector<QPoint> hull(2 * n);
+    int k = 0;
+    // Lower chain
+    for (int i = 0; i < n; i++) {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], sorted[i]) <= 0)
+            k--;
+        hull[k++] = sorted[i];
+    }
+    // Upper chain
+    for (int i = n - 2, lower = k + 1; i >= 0; i--) {
+        while (k >= lower && cross(hull[k - 2], hull[k - 1], sorted[i]) <= 0)
+            k--;
+        hull[k++] = sorted[i];
+    }
+    hull.resize(k - 1); // Last point repeats the first
+    if (hull.size() == 2 && hull[0] == hull[1])
+        hull.resize(1);
+    return hull;
+}
+
+inline QVector<QPoint> monotoneChain(QVector<QPoint> points) {
+    std::sort(points.begin(), points.end(), lessXY);
+    return monotoneChainSorted(points);
+}
+
+// Hull of the extreme points in the eight axis and diagonal directions, counter-clockwise.
+// It lies inside the hull of all the points. The points are at(0) to at(n - 1), for
+// inputs that are not in a QVector.
+template <typename At>
+QVector<QPoint> extremeOctagon(qint64 n, At at) {
+    if (n == 0)
+        return QVector<QPoint>();
+    auto keys = [](const QPoint& p, qint64* key) {
+        const qint64 x = p.x(), y = p.y();
+        key[0] = x;      key[1] = -x;     key[2] = y;      key[3] = -y;
+        key[4] = x + y;  key[5] = -x - y; key[6] = x - y;  key[7] = y - x;
+    };
+    QVector<QPoint> corners(8, at(0));
+    qint64 best[8], key[8];
+    keys(at(0), best);
+    for (qint64 i = 0; i < n; i++) {
+        const QPoint p = at(i);
+        keys(p, key);
+        for (int d = 0; d < 8; d++) {
+            if (key[d] > best[d]) {
+                best[d] = key[d];
+                corners[d] = p;
+            }
+        }
+    }
+    return monotoneChain(corners);
+}
+
+inline QVector<QPoint> extremeOctagon(const QVector<QPoint>& points) {
+    return extremeOctagon(points.size(), [&points](qint64 i) { return points[static_cast<int>(i)]; });
+}
+
+// Drops the points strictly inside extremeOctagon() (Akl-Toussaint). None of them is a
+// hull vertex, and on most inputs only a small part of the points remains to be sorted.
+inline void discardInterior(QVector<QPoint>& points) {
+    if (points.size() <= 8)
+        return;
+    const QVector<QPoint> octagon = extremeOctagon(points);
+    if (octagon.size() < 3)
+        return;
+    auto interior = [&octagon](const QPoint& p) {
+        for (int i = 0; i < octagon.size(); i++) {
+            if (cross(octagon[i], octagon[(i + 1) % octagon.size()], p) <= 0)
+                return false;
+        }
+        return true;
+    };
+    points.erase(std::remove_if(points.begin(), points.end(), interior), points.end());
+}
+
+// Vertices of a hull from monotoneChain() in lessXY order, in O(h)
+inline QVector<QPoint> sortedVertices(const QVector<QPoint>& hull) {
+    int right = 0;
+    for (int i = 1; i < hull.size(); i++) {
+        if (lessXY(hull[right], hull[i]))
+            right = i;
+    }
+    // Lower chain runs up to the rightmost vertex, the upper chain comes back
+    QVector<QPoint> lower(hull.begin(), hull.begin() + right + 1);
+    QVector<QPoint> upper(hull.rbegin(), hull.rend() - right - 1);
+    QVector<QPoint> sorted(hull.size());
+    std::merge(lower.begin(), lower.end(), upper.begin(), upper.end(), sorted.begin(), lessXY);
+    return sorted;
+}
+
+// Hull of the union of several hulls from monotoneChain(), in O(H log k) for k hulls
+// with H vertices in total
+inline QVector<QPoint> mergeHulls(const QVector<QVector<QPoint>>& hulls) {
+    QVector<QVector<QPoint>> runs;
+    for (const QVector<QPoint>& hull : hulls) {
+        if (!hull.isEmpty())
+            runs.append(sortedVertices(hull));
+    }
+    if (runs.isEmpty())
+        return QVector<QPoint>();
+
+    // Pairwise merging of the sorted runs
+    while (runs.size() > 1) {
+        QVector<QVector<QPoint>> merged;
+        for (int i = 0; i + 1 < runs.size(); i += 2) {
+            QVector<QPoint> both(runs[i].size() + runs[i + 1].size());
+            std::merge(runs[i].begin(), runs[i].end(), runs[i + 1].begin(), runs[i + 1].end(), both.begin(), lessXY);
+            merged.append(both);
+        }
+        if (runs.size() % 2 == 1)
+            merged.append(runs.last());
+        runs.swap(merged);
+    }
+    return monotoneChainSorted(runs.first());
+}
+
+// Number of threads for n points: one below the threshold, otherwise one per core up to 16
+inline int workerCount(int n, int threshold) {
+    if (n < threshold)
+        return 1;
+    return std::max(1, std::min(16, static_cast<int>(std::thread::hardware_concurrency())));
+}
+
+// Runs body(begin, end, thread) over equal slices of [0, n) on the given number of threads
+template <typename Body>
+void forSlices(int n, int threads, Body body) {
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+        workers.emplace_back(body, static_cast<int>(static_cast<qint64>(n) * t / threads),
+                             static_cast<int>(static_cast<qint64>(n) * (t + 1) / threads), t);
+    }
+    body(0, static_cast<int>(static_cast<qint64>(n) / threads), 0);
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+} // namespace HullUtils
+
+#endif // HULLUTILS_H
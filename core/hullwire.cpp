@@ -0,0 +1,70 @@
+#include "hullwire.h"
+#include <cerrno>
+#include <unistd.h>
+
+namespace HullWire {
+
+bool writeAll(int fd, const void* data, std::size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = ::write(fd, bytes, size);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return false;
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+bool readAll(int fd, void* data, std::size_t size) {
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t got = ::read(fd, bytes, size);
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got <= 0)
+            return false;
+        bytes += got;
+        size -= static_cast<std::size_t>(got);
+    }
+    return true;
+}
+
+bool writeHull(int fd, const QVector<QPoint>& hull) {
+    QVector<qint32> message;
+    message.reserve(1 + 2 * hull.size());
+    message.append(static_cast<qint32>(hull.size()));
+    for (const QPoint& p : hull) {
+        message.append(p.x());
+        message.append(p.y());
+    }
+    return writeAll(fd, message.constData(), message.size() * sizeof(qint32));
+}
+
+bool readHull(int fd, QVector<QPoint>& hull) {
+    quint32 count = 0;
+    return readCount(fd, count) && readPoints(fd, count, hull);
+}
+
+bool readCount(int fd, quint32& count) {
+    return readAll(fd, &count, sizeof(count));
+}
+
+bool readPoints(int fd, quint32 count, QVector<QPoint>& hull) {
+    if (count > MaxPoints)
+        return false;
+
+    const qint64 values = 2 * static_cast<qint64>(count);
+    QVector<qint32> xy(static_cast<int>(values));
+    if (!readAll(fd, xy.data(), static_cast<std::size_t>(values) * sizeof(qint32)))
+        return false;
+
+    hull.resize(static_cast<int>(count));
+    for (int i = 0; i < hull.size(); i++)
+        hull[i] = QPoint(xy[2 * i], xy[2 * i + 1]);
+    return true;
+}
+
+} // namespace HullWire
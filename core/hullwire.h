@@ -0,0 +1,29 @@
+#ifndef HULLWIRE_H
+#define HULLWIRE_H
+
+#include <QVector>
+#include <QPoint>
+#include <cstddef>
+
+// Binary transport of hulls over pipes and sockets.
+// A hull is sent as a quint32 vertex count followed by qint32 x, y pairs in host byte
+// order, which is all that is needed between processes on the same machine.
+namespace HullWire {
+
+bool writeAll(int fd, const void* data, std::size_t size);
+bool readAll(int fd, void* data, std::size_t size);
+
+// Largest vertex count a reader accepts, 256 MiB of coordinates. Longer lists are
+// refused before anything is allocated for them.
+constexpr quint32 MaxPoints = 1u << 25;
+
+bool writeHull(int fd, const QVector<QPoint>& hull);
+// Fails on a count above MaxPoints, leaving the coordinates unread
+bool readHull(int fd, QVector<QPoint>& hull);
+// The two halves of readHull, for readers that answer an oversized count themselves
+bool readCount(int fd, quint32& count);
+bool readPoints(int fd, quint32 count, QVector<QPoint>& hull);
+
+} // namespace HullWire
+
+#endif // HULLWIRE_H
@@ -0,0 +1,71 @@
+#ifndef JARVISMARCH_H
+#define JARVISMARCH_H
+
+#include <QVector>
+#include <QPoint>
+
+#include "convexhull.h"
+#include "hullutils.h"
+
+class JarvisMarch : public TracedHull<JarvisMarch>
+{
+public:
+    JarvisMarch(const QVector<QPoint>& points)
+        : TracedHull(points) {}
+
+    // Gift wrapping, counter-clockwise from the leftmost point
+    template <typename Tracer>
+    QVector<QPoint> run(Tracer& tracer)
+    {
+        int n = points.size();
+        QVector<QPoint> hull;
+
+        if (n < 3)
+            return HullUtils::monotoneChain(points);
+
+        // Find the leftmost point, the lowest one if there are ties
+        int l = 0;
+        for (int i = 1; i < n; i++)
+            if (HullUtils::lessXY(points[i], points[l]))
+                l = i;
+
+        // Start from leftmost point, keep moving counterclockwise
+        int p = l, q;
+        do {
+            // Add current point to result
+            hull.append(points[p]);
+
+            // Search for a point 'q' such that no point lies to the right of p -> q.
+            // Of collinear candidates the farthest wins, so collinear and duplicate points are skipped.
+            q = p;
+            for (int i = 0; i < n; i++) {
+                if (points[i] == points[p])
+                    continue;
+                qint64 turn = q == p ? -1 : HullUtils::cross(points[p], points[q], points[i]);
+                if (turn < 0 || (turn == 0 && distance(points[p], points[i]) > distance(points[p], points[q]))) {
+                    q = i;
+                    tracer.test(points[p], points[q]);
+                }
+            }
+            if (q == p)
+                break; // All points coincide
+
+            // Now q is the most counterclockwise with respect to p
+            tracer.accept(points[p], points[q]);
+            p = q;
+
+        } while (points[p] != points[l]); // While we don't come to first point
+
+        return hull;
+    }
+
+private:
+    static qint64 distance(const QPoint& a, const QPoint& b)
+    {
+        qint64 dx = a.x() - b.x();
+        qint64 dy = a.y() - b.y();
+        return dx * dx + dy * dy;
+    }
+};
+
+#endif // JARVISMARCH_H
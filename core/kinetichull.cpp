@@ -0,0 +1,191 @@
+#include "kinetichull.h"
+#include "hullutils.h"
+#include <cmath>
+
+namespace {
+
+// Rounding moves a point by at most half a unit diagonal, at the rebuild and again now
+const double RoundingSlack = std::sqrt(2.0);
+
+// Inward normal of a counter-clockwise edge, scaled to unit length
+struct EdgeLine {
+    double nx, ny, x, y;
+    double depth(const QPoint& p) const { return nx * (p.x() - x) + ny * (p.y() - y); }
+};
+
+QVector<EdgeLine> edgeLines(const QVector<QPoint>& polygon) {
+    QVector<EdgeLine> lines;
+    for (int i = 0; i < polygon.size(); i++) {
+        const QPoint& a = polygon[i];
+        const QPoint& b = polygon[(i + 1) % polygon.size()];
+        const double length = std::hypot(b.x() - a.x(), b.y() - a.y());
+        lines.append({-(b.y() - a.y()) / length, (b.x() - a.x()) / length,
+                      static_cast<double>(a.x()), static_cast<double>(a.y())});
+    }
+    return lines;
+}
+
+// True if p is deeper than band inside every line
+bool deeper(const QVector<EdgeLine>& lines, const QPoint& p, double band) {
+    for (const EdgeLine& line : lines) {
+        if (line.depth(p) <= band)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+KineticHull::KineticHull(const QVector<QPoint>& points, const QVector<QPointF>& velocities)
+    : velocities(velocities), positions(points) {
+    exact.reserve(points.size());
+    for (const QPoint& p : points)
+        exact.append(QPointF(p));
+    for (const QPointF& v : velocities)
+        maxSpeed = std::max(maxSpeed, std::hypot(v.x(), v.y()));
+
+    if (!points.isEmpty()) {
+        double left = points.first().x(), right = left, top = points.first().y(), bottom = top;
+        for (const QPoint& p : points) {
+            left = std::min<double>(left, p.x());
+            right = std::max<double>(right, p.x());
+            top = std::min<double>(top, p.y());
+            bottom = std::max<double>(bottom, p.y());
+        }
+        bounds = QRectF(left, top, right - left, bottom - top);
+    }
+    rebuild();
+}
+
+const QVector<QPoint>& KineticHull::points() const {
+    return positions;
+}
+
+const QVector<QPoint>& KineticHull::hull() const {
+    return hullPoints;
+}
+
+int KineticHull::candidateCount() const {
+    return candidates.size();
+}
+
+int KineticHull::rebuildCount() const {
+    return rebuilds;
+}
+
+void KineticHull::advance(double dt) {
+    move(dt);
+    sinceRebuild += dt;
+    sinceNext += dt;
+    if (sinceRebuild >= certifiedFor) {
+        rebuild();
+        return;
+    }
+
+    QVector<QPoint> moved;
+    moved.reserve(candidates.size());
+    for (int index : candidates)
+        moved.append(positions[index]);
+    HullUtils::discardInterior(moved);
+    hullPoints = HullUtils::monotoneChain(moved);
+    refresh(dt);
+}
+
+void KineticHull::move(double dt) {
+    const int n = exact.size();
+    HullUtils::forSlices(n, HullUtils::workerCount(n, ParallelThreshold), [this, dt](int begin, int end, int) {
+        for (int i = begin; i < end; i++) {
+            QPointF& p = exact[i];
+            QPointF& v = velocities[i];
+            p += v * dt;
+            // Reflect off the walls, the distance travelled stays the same
+            if (p.x() < bounds.left() || p.x() > bounds.right()) {
+                p.setX(p.x() < bounds.left() ? 2 * bounds.left() - p.x() : 2 * bounds.right() - p.x());
+                v.setX(-v.x());
+            }
+            if (p.y() < bounds.top() || p.y() > bounds.bottom()) {
+                p.setY(p.y() < bounds.top() ? 2 * bounds.top() - p.y() : 2 * bounds.bottom() - p.y());
+                v.setY(-v.y());
+            }
+            p.setX(qBound(bounds.left(), p.x(), bounds.right()));
+            p.setY(qBound(bounds.top(), p.y(), bounds.bottom()));
+            positions[i] = p.toPoint();
+        }
+    });
+}
+
+void KineticHull::rebuild() {
+    rebuilds++;
+    sinceRebuild = 0.0;
+    certifiedFor = maxSpeed > 0 ? horizon : INFINITY;
+    nextCursor = -1;
+
+    QVector<QPoint> filtered = positions;
+    HullUtils::discardInterior(filtered);
+    hullPoints = HullUtils::monotoneChain(filtered);
+    candidates.clear();
+    classify(0, positions.size(), horizon, candidates);
+    adaptHorizon();
+}
+
+void KineticHull::refresh(double dt) {
+    const int n = positions.size();
+    if (maxSpeed <= 0 || sinceRebuild < certifiedFor / 2)
+        return;
+    if (nextCursor < 0) {
+        next.clear();
+        nextCursor = 0;
+        nextHorizon = horizon;
+        sinceNext = 0.0;
+    }
+
+    // Sized to be done a quarter of the certificate in, at the current frame rate
+    const qint64 slice = std::max<qint64>(4096, static_cast<qint64>(std::ceil(n * dt * 4 / certifiedFor)));
+    const int end = static_cast<int>(std::min<qint64>(n, nextCursor + slice));
+    classify(nextCursor, end, nextHorizon, next);
+    nextCursor = end;
+    if (nextCursor == n) {
+        // Every slice was checked against the hull of its own frame, the first one decides
+        // how long the new candidates hold
+        candidates.swap(next);
+        certifiedFor = nextHorizon;
+        sinceRebuild = sinceNext;
+        nextCursor = -1;
+        adaptHorizon();
+    }
+}
+
+void KineticHull::classify(int begin, int end, double horizon, QVector<int>& out) const {
+    if (hullPoints.size() < 3) {
+        // A degenerate hull has no inside to be deep in
+        for (int i = begin; i < end; i++)
+            out.append(i);
+        return;
+    }
+
+    // Points deep inside the octagon are deeper still inside the hull, which is checked
+    // edge by edge only for the rest
+    const double band = 2.0 * (maxSpeed * (maxSpeed > 0 ? horizon : 0.0) + RoundingSlack);
+    const QVector<EdgeLine> octagon = edgeLines(HullUtils::extremeOctagon(hullPoints));
+    const QVector<EdgeLine> edges = edgeLines(hullPoints);
+    const int threads = HullUtils::workerCount(end - begin, ParallelThreshold);
+    QVector<QVector<int>> found(threads);
+    HullUtils::forSlices(end - begin, threads, [&](int from, int to, int t) {
+        for (int i = begin + from; i < begin + to; i++) {
+            const bool deep = octagon.size() >= 3 && deeper(octagon, positions[i], band);
+            if (!deep && !deeper(edges, positions[i], band))
+                found[t].append(i);
+        }
+    });
+    for (const QVector<int>& part : found)
+        out += part;
+}
+
+void KineticHull::adaptHorizon() {
+    // Aim for a band holding a small part of the points, but with rebuilds not every frame
+    const int n = positions.size();
+    if (candidates.size() > n / 16 && horizon > MinHorizon)
+        horizon /= 2;
+    else if (candidates.size() < n / 64 && horizon < MaxHorizon)
+        horizon *= 2;
+}
@@ -0,0 +1,67 @@
+#ifndef KINETICHULL_H
+#define KINETICHULL_H
+
+#include <QVector>
+#include <QPoint>
+#include <QPointF>
+#include <QRectF>
+
+// Convex hull of points moving with constant speed, kept up to date frame by frame.
+//
+// The points within a band of the hull boundary are kept as candidates. Every point moves
+// at most maxSpeed * t in t seconds and so does every hull edge, so a point deeper than
+// 2 * maxSpeed * t cannot reach the hull before then, and a frame only takes the hull of
+// the candidates. From halfway through that certificate each frame checks a slice of the
+// points against the current hull, and the new candidates take over once all points are
+// checked. Only if the certificate runs out first are all points rebuilt at once.
+class KineticHull
+{
+public:
+    // Velocities are in units per second. Points bounce off the bounding box of their
+    // starting positions, which keeps their speed.
+    KineticHull(const QVector<QPoint>& points, const QVector<QPointF>& velocities);
+
+    // Moves every point dt seconds on and updates the hull
+    void advance(double dt);
+
+    // Current positions, rounded to whole units
+    const QVector<QPoint>& points() const;
+    // Hull of points(), counter-clockwise
+    const QVector<QPoint>& hull() const;
+
+    int candidateCount() const;
+    int rebuildCount() const;
+
+    // Seconds a rebuild's candidates stay valid, adapted to keep the band narrow
+    static constexpr double MinHorizon = 0.05;
+    static constexpr double MaxHorizon = 4.0;
+    static constexpr int ParallelThreshold = 100'000;
+
+private:
+    void move(double dt);
+    void rebuild();
+    void refresh(double dt);
+    void classify(int begin, int end, double horizon, QVector<int>& out) const;
+    void adaptHorizon();
+
+    QVector<QPointF> exact;      // Positions before rounding
+    QVector<QPointF> velocities;
+    QVector<QPoint> positions;
+    QRectF bounds;
+    double maxSpeed = 0.0;
+
+    double horizon = 1.0;        // Certificate length of the next rebuild
+    double certifiedFor = 0.0;   // Certificate length of the current candidates
+    double sinceRebuild = 0.0;
+    QVector<int> candidates;     // Indices of the points that may be on the hull
+    QVector<QPoint> hullPoints;
+    int rebuilds = 0;
+
+    // Candidates being gathered for the next certificate
+    QVector<int> next;
+    int nextCursor = -1;         // First point not checked yet, -1 when idle
+    double nextHorizon = 0.0;
+    double sinceNext = 0.0;      // Seconds since the first slice was checked
+};
+
+#endif // KINETICHULL_H
@@ -0,0 +1,185 @@
+#include "melkmanhull.h"
+#include "hullutils.h"
+#include <QFile>
+#include <limits>
+
+using HullUtils::cross;
+
+MelkmanHull::MelkmanHull(bool knownSimple)
+    : knownSimple(knownSimple) {}
+
+void MelkmanHull::clear() {
+    chain.clear();
+    startCount = 0;
+    count = 0;
+    repairs = 0;
+}
+
+qint64 MelkmanHull::pointCount() const {
+    return count;
+}
+
+int MelkmanHull::repairCount() const {
+    return repairs;
+}
+
+QString MelkmanHull::errorString() const {
+    return error;
+}
+
+void MelkmanHull::push(const QPoint& point) {
+    count++;
+    if (chain.empty()) {
+        // Until three vertices span a triangle, keep the two ends of the line they are on,
+        // start[0] before start[1] in lessXY order
+        if (startCount < 2) {
+            if (startCount == 0 || point != start[0])
+                start[startCount++] = point;
+            if (startCount == 2 && HullUtils::lessXY(start[1], start[0]))
+                std::swap(start[0], start[1]);
+            return;
+        }
+        const qint64 turn = cross(start[0], start[1], point);
+        if (turn == 0) {
+            start[0] = std::min(start[0], point, HullUtils::lessXY);
+            start[1] = std::max(start[1], point, HullUtils::lessXY);
+            return;
+        }
+        if (turn > 0)
+            chain = {point, start[0], start[1], point};
+        else
+            chain = {point, start[1], start[0], point};
+        return;
+    }
+
+    const int n = static_cast<int>(chain.size());
+    if (cross(chain[n - 2], chain[n - 1], point) >= 0 && cross(chain[0], chain[1], point) >= 0) {
+        // Inside the wedge at the newest vertex, so inside the hull if the chain is simple
+        if (!knownSimple && !contains(point))
+            repair(point);
+        return;
+    }
+
+    // The newest vertex sees the point, so the edges it sees run through the ends
+    while (cross(chain[chain.size() - 2], chain.back(), point) <= 0)
+        chain.pop_back();
+    chain.push_back(point);
+    while (cross(chain[0], chain[1], point) <= 0)
+        chain.pop_front();
+    chain.push_front(point);
+}
+
+bool MelkmanHull::contains(const QPoint& point) const {
+    // Binary search for the fan triangle around chain[0] that holds the point
+    const int m = static_cast<int>(chain.size()) - 1;
+    if (cross(chain[0], chain[1], point) < 0 || cross(chain[0], chain[m - 1], point) > 0)
+        return false;
+    int low = 1, high = m - 1;
+    while (high - low > 1) {
+        const int middle = (low + high) / 2;
+        if (cross(chain[0], chain[middle], point) >= 0)
+            low = middle;
+        else
+            high = middle;
+    }
+    return cross(chain[low], chain[high], point) >= 0;
+}
+
+void MelkmanHull::repair(const QPoint& point) {
+    // The point sees a part of the hull away from the ends. Take the general hull of the
+    // vertices and the point, then turn it so the point is at both ends again.
+    repairs++;
+    QVector<QPoint> vertices(chain.begin(), chain.end() - 1);
+    vertices.append(point);
+    QVector<QPoint> hull = HullUtils::monotoneChain(vertices);
+    const int at = static_cast<int>(std::find(hull.begin(), hull.end(), point) - hull.begin());
+    std::rotate(hull.begin(), hull.begin() + at, hull.end());
+    chain.assign(hull.begin(), hull.end());
+    chain.push_back(point);
+}
+
+QVector<QPoint> MelkmanHull::hull() const {
+    if (chain.empty()) {
+        QVector<QPoint> ends(start, start + startCount);
+        return HullUtils::monotoneChain(ends);
+    }
+    QVector<QPoint> hull(chain.begin(), chain.end() - 1);
+    std::rotate(hull.begin(), std::min_element(hull.begin(), hull.end(), HullUtils::lessXY), hull.end());
+    return hull;
+}
+
+bool MelkmanHull::readFile(const QString& path, QVector<QPoint>* points) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        error = QString("Cannot open %1").arg(path);
+        return false;
+    }
+    auto take = [this, points](qint32 x, qint32 y) {
+        push(QPoint(x, y));
+        if (points)
+            points->append(QPoint(x, y));
+    };
+
+    const qint64 BlockSize = 1 << 20;
+    if (!path.endsWith(".txt") && !path.endsWith(".csv")) {
+        if (file.size() % (2 * sizeof(qint32)) != 0) {
+            error = QString("%1 is not a list of qint32 x, y pairs").arg(path);
+            return false;
+        }
+        QVector<qint32> block(static_cast<int>(BlockSize / sizeof(qint32)));
+        qint64 bytes;
+        while ((bytes = file.read(reinterpret_cast<char*>(block.data()), BlockSize)) > 0) {
+            for (qint64 i = 0; i + 1 < bytes / static_cast<qint64>(sizeof(qint32)); i += 2)
+                take(block[i], block[i + 1]);
+        }
+        return true;
+    }
+
+    // Same number scanner as ShardedHull, carried across block boundaries
+    const qint64 limit = std::numeric_limits<qint32>::max();
+    qint64 value = 0, offset = 0;
+    bool inNumber = false, negative = false, inComment = false, haveX = false;
+    qint32 x = 0;
+    // Signs without digits, decimals and out of range values are not qint32 coordinates
+    auto invalid = [&](char next) {
+        if ((negative && !inNumber) || value > limit + negative || next == '.' || (inNumber && next == '-')) {
+            error = QString("%1: invalid number near byte %2").arg(path).arg(offset);
+            return true;
+        }
+        return false;
+    };
+    auto finishNumber = [&]() {
+        if (!inNumber)
+            return;
+        const qint32 number = static_cast<qint32>(negative ? -value : value);
+        if (haveX)
+            take(x, number);
+        else
+            x = number;
+        haveX = !haveX;
+        inNumber = negative = false;
+        value = 0;
+    };
+    QByteArray block;
+    while (!(block = file.read(BlockSize)).isEmpty()) {
+        for (char c : block) {
+            if (inComment) {
+                inComment = c != '\n';
+            } else if (c >= '0' && c <= '9') {
+                inNumber = true;
+                value = std::min(value * 10 + (c - '0'), limit + 2);
+            } else if (invalid(c)) {
+                return false;
+            } else {
+                finishNumber();
+                inComment = c == '#';
+                negative = c == '-';
+            }
+            offset++;
+        }
+    }
+    if (invalid('\n'))
+        return false;
+    finishNumber();
+    return true;
+}
@@ -0,0 +1,54 @@
+#ifndef MELKMANHULL_H
+#define MELKMANHULL_H
+
+#include <QVector>
+#include <QPoint>
+#include <QString>
+#include <deque>
+
+// Convex hull of a polyline fed one vertex at a time (Melkman's algorithm).
+//
+// The hull is kept in a deque with the newest hull vertex at both ends. A new vertex
+// inside the wedge of the two end edges is skipped, otherwise vertices are popped from
+// both ends until it fits. Only the hull is stored, so outlines of any length stream
+// through in O(h) memory.
+//
+// Skipping wedge points is only right for simple polylines. Unless the chain is known to
+// be simple, a skipped point is checked against the hull in O(log h), and one found
+// outside is merged in with a general hull step instead.
+class MelkmanHull
+{
+public:
+    explicit MelkmanHull(bool knownSimple = false);
+
+    void push(const QPoint& point);
+    void clear();
+
+    // Streams the vertices of a polyline file through push(), in the formats of
+    // ShardedHull: raw qint32 x, y pairs, or "x y" text lines for .txt and .csv files.
+    // The vertices are also appended to points when given.
+    bool readFile(const QString& path, QVector<QPoint>* points = nullptr);
+    QString errorString() const;
+
+    // Hull counter-clockwise from the lowest vertex in lessXY order, as HullUtils::monotoneChain
+    QVector<QPoint> hull() const;
+
+    qint64 pointCount() const;
+    // Points found outside the hull although Melkman would have skipped them. Any such
+    // point shows the chain is not simple.
+    int repairCount() const;
+
+private:
+    bool knownSimple;
+    std::deque<QPoint> chain;  // Hull counter-clockwise, front and back are the same vertex
+    QPoint start[2];           // Extremes of the collinear vertices before chain exists
+    int startCount = 0;
+    qint64 count = 0;
+    int repairs = 0;
+    QString error;
+
+    bool contains(const QPoint& point) const;
+    void repair(const QPoint& point);
+};
+
+#endif // MELKMANHULL_H
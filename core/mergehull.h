@@ -4,22 +4,21 @@
 #include <QVector>
 #include <QPoint>
 #include <algorithm>
-#include <QDebug>
 #include "convexhull.h"
 
-class MergeHull : public ConvexHull {
+class MergeHull : public TracedHull<MergeHull> {
 public:
     MergeHull(const QVector<QPoint>& points)
-        : ConvexHull(points) {}
+        : TracedHull(points) {}
 
-    QVector<QPoint> compute() override {
-        return _compute(0, points.size(), 0);
+    template <typename Tracer>
+    QVector<QPoint> run(Tracer& tracer) {
+        return _compute(0, points.size(), tracer, 0);
     }
 
-    QVector<QPoint> compute_animate() override {}
-
 private:
-    QVector<QPoint> _compute(int start, int end, int direction = 0) {
+    template <typename Tracer>
+    QVector<QPoint> _compute(int start, int end, Tracer& tracer, int direction = 0) {
         QVector<QPoint>& S = points;
 
         // Base case
@@ -29,7 +28,9 @@ private:
             for (int i = start; i < end; ++i) {
                 baseHull.append(S[i]);
             }
-            return grahamScan(baseHull); // Ensure the base case returns a proper hull
+            QVector<QPoint> hull = grahamScan(baseHull); // Ensure the base case returns a proper hull
+            traceEdges(hull, tracer, &Tracer::accept);
+            return hull;
         }
 
         int newDir = direction == 0 ? 1 : 0;   // Change direction
@@ -57,18 +58,35 @@ private:
         int middleIndex = start + size / 2;
 
         // Recursively pass the two halves
-        QVector<QPoint> hullL = _compute(start, middleIndex, newDir);
-        QVector<QPoint> hullR = _compute(middleIndex, end, newDir);
+        QVector<QPoint> hullL = _compute(start, middleIndex, tracer, newDir);
+        QVector<QPoint> hullR = _compute(middleIndex, end, tracer, newDir);
 
-        // Merge without animating
-        return mergeHulls(hullL, hullR);
+        return mergeHulls(hullL, hullR, tracer);
     }
 
-    QVector<QPoint> mergeHulls(const QVector<QPoint>& left, const QVector<QPoint>& right) {
+    template <typename Tracer>
+    QVector<QPoint> mergeHulls(const QVector<QPoint>& left, const QVector<QPoint>& right, Tracer& tracer) {
         // Simplified merging logic, using Graham's scan to ensure the result is a proper convex hull
         QVector<QPoint> result = left + right;
+        QVector<QPoint> merged = grahamScan(result);
+
+        // The two sub-hulls are replaced by the merged one
+        traceEdges(left, tracer, &Tracer::reject);
+        traceEdges(right, tracer, &Tracer::reject);
+        traceEdges(merged, tracer, &Tracer::accept);
+        return merged;
+    }
 
-        return grahamScan(result);
+    // Reports every edge of a closed hull
+    template <typename Tracer>
+    static void traceEdges(const QVector<QPoint>& hull, Tracer& tracer, void (Tracer::*step)(const QPoint&, const QPoint&)) {
+        if constexpr (!Tracer::enabled)
+            return;
+        if (hull.size() < 2)
+            return;
+        for (int i = 0; i < hull.size(); i++) {
+            (tracer.*step)(hull[i], hull[(i + 1) % hull.size()]);
+        }
     }
 
     QVector<QPoint> grahamScan(QVector<QPoint>& points) {
@@ -0,0 +1,135 @@
+#include "parallelgrahamscan.h"
+#include "hullutils.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// One independent piece of a merge: a[0..na) and b[0..nb) merged into out
+struct MergeTask {
+    const QPoint* a;
+    int na;
+    const QPoint* b;
+    int nb;
+    QPoint* out;
+};
+
+// Splits the merge of two sorted runs into parts pieces of about the same size. The
+// longer run is cut evenly and the matching split points of the other run are found
+// with binary search, so every piece writes its own part of out.
+void splitMerge(const QPoint* a, int na, const QPoint* b, int nb, QPoint* out, int parts,
+                std::vector<MergeTask>& tasks) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    parts = std::max(1, std::min(parts, na));
+    int bBegin = 0;
+    for (int p = 0; p < parts; p++) {
+        int aBegin = static_cast<int>(static_cast<qint64>(na) * p / parts);
+        int aEnd = static_cast<int>(static_cast<qint64>(na) * (p + 1) / parts);
+        int bEnd = nb;
+        if (p + 1 < parts)
+            bEnd = static_cast<int>(std::lower_bound(b, b + nb, a[aEnd], HullUtils::lessXY) - b);
+        tasks.push_back({a + aBegin, aEnd - aBegin, b + bBegin, bEnd - bBegin, out + aBegin + bBegin});
+        bBegin = bEnd;
+    }
+}
+
+// Sorts points with lessXY: every thread sorts one slice, then the sorted runs are merged
+// pairwise with all threads working on every round
+void parallelSort(QVector<QPoint>& points, int threads) {
+    const int n = points.size();
+    QPoint* data = points.data();
+    HullUtils::forSlices(n, threads, [data](int begin, int end, int) {
+        std::sort(data + begin, data + end, HullUtils::lessXY);
+    });
+
+    QVector<int> bounds;
+    for (int t = 0; t <= threads; t++)
+        bounds.append(static_cast<int>(static_cast<qint64>(n) * t / threads));
+
+    QVector<QPoint> buffer(n);
+    QPoint* from = data;
+    QPoint* to = buffer.data();
+    while (bounds.size() > 2) {
+        const int runs = bounds.size() - 1;
+        const int parts = std::max(1, threads / (runs / 2));
+        std::vector<MergeTask> tasks;
+        QVector<int> merged;
+        for (int r = 0; r < runs; r += 2) {
+            merged.append(bounds[r]);
+            if (r + 1 == runs) {
+                // Odd run out is carried over to the next round
+                tasks.push_back({from + bounds[r], bounds[r + 1] - bounds[r], nullptr, 0, to + bounds[r]});
+                continue;
+            }
+            splitMerge(from + bounds[r], bounds[r + 1] - bounds[r], from + bounds[r + 1],
+                       bounds[r + 2] - bounds[r + 1], to + bounds[r], parts, tasks);
+        }
+        merged.append(n);
+
+        const int count = static_cast<int>(tasks.size());
+        HullUtils::forSlices(count, count, [&tasks](int begin, int end, int) {
+            for (int i = begin; i < end; i++) {
+                const MergeTask& task = tasks[i];
+                std::merge(task.a, task.a + task.na, task.b, task.b + task.nb, task.out, HullUtils::lessXY);
+            }
+        });
+
+        bounds.swap(merged);
+        std::swap(from, to);
+    }
+    if (from != data)
+        std::copy(from, from + n, data);
+}
+
+} // namespace
+
+ParallelGrahamScan::ParallelGrahamScan(const QVector<QPoint>& points, int maxThreads)
+    : TracedHull(points), maxThreads(maxThreads) {}
+
+template <typename Tracer>
+QVector<QPoint> ParallelGrahamScan::run(Tracer& tracer) {
+    const int n = points.size();
+    int threads = HullUtils::workerCount(n, ParallelThreshold);
+    if (maxThreads > 0)
+        threads = std::min(threads, maxThreads);
+    if (threads == 1) {
+        QVector<QPoint> hull = HullUtils::monotoneChain(points);
+        if constexpr (Tracer::enabled) {
+            for (int i = 0; i < hull.size(); i++)
+                tracer.accept(hull[i], hull[(i + 1) % hull.size()]);
+        }
+        return hull;
+    }
+
+    parallelSort(points, threads);
+
+    // Chains of every slab of the sorted array
+    QVector<QVector<QPoint>> slabs(threads);
+    HullUtils::forSlices(n, threads, [this, &slabs](int begin, int end, int t) {
+        slabs[t] = HullUtils::monotoneChainSorted(points.mid(begin, end - begin));
+    });
+
+    // The slabs follow each other in lessXY order, so their vertices concatenate into one
+    // sorted run and a single chain pass stitches them
+    QVector<QPoint> candidates;
+    for (const QVector<QPoint>& slab : slabs) {
+        if constexpr (Tracer::enabled) {
+            for (int i = 0; i < slab.size(); i++)
+                tracer.test(slab[i], slab[(i + 1) % slab.size()]);
+        }
+        candidates += HullUtils::sortedVertices(slab);
+    }
+
+    QVector<QPoint> hull = HullUtils::monotoneChainSorted(candidates);
+    if constexpr (Tracer::enabled) {
+        for (int i = 0; i < hull.size(); i++)
+            tracer.accept(hull[i], hull[(i + 1) % hull.size()]);
+    }
+    return hull;
+}
+
+template QVector<QPoint> ParallelGrahamScan::run(NullTracer& tracer);
+template QVector<QPoint> ParallelGrahamScan::run(SteppingTracer& tracer);
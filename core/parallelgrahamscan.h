@@ -0,0 +1,30 @@
+#ifndef PARALLELGRAHAMSCAN_H
+#define PARALLELGRAHAMSCAN_H
+
+#include <QVector>
+#include <QPoint>
+
+#include "convexhull.h"
+
+// Monotone chain Graham scan spread over all cores.
+// The points are sorted with a parallel merge sort, the sorted array is cut into one slab
+// per thread and the chains of every slab are built at the same time. Since the slabs are
+// already ordered by x, the slab hulls are stitched with one more linear chain pass.
+class ParallelGrahamScan : public TracedHull<ParallelGrahamScan>
+{
+public:
+    // maxThreads caps the threads used, 0 leaves it to HullUtils::workerCount()
+    ParallelGrahamScan(const QVector<QPoint>& points, int maxThreads = 0);
+
+    // Instantiated for every tracer in parallelgrahamscan.cpp
+    template <typename Tracer>
+    QVector<QPoint> run(Tracer& tracer);
+
+    // Smaller inputs are handled on the calling thread
+    static constexpr int ParallelThreshold = 50'000;
+
+private:
+    int maxThreads;
+};
+
+#endif // PARALLELGRAHAMSCAN_H
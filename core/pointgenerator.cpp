@@ -0,0 +1,184 @@
+#include "pointgenerator.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int ClusterCount = 8;
+const int DuplicateLocations = 64;
+
+// Values drawn once per set, shared by all chunks
+struct SharedSetup {
+    QVector<QPointF> centers;
+    QVector<QPoint> locations;
+};
+
+void fillChunk(PointGenerator::Distribution distribution, const QRectF& area, const SharedSetup& setup,
+               std::mt19937& gen, QPoint* out, int count) {
+    using Distribution = PointGenerator::Distribution;
+    const double pi = 3.14159265358979323846;
+    double centerX = area.center().x();
+    double centerY = area.center().y();
+    double shortSide = std::min(area.width(), area.height());
+
+    switch (distribution) {
+    case Distribution::Uniform: {
+        std::uniform_int_distribution<> distribX(area.left(), area.right());
+        std::uniform_int_distribution<> distribY(area.top(), area.bottom());
+        for (int i = 0; i < count; ++i) {
+            out[i] = QPoint(distribX(gen), distribY(gen));
+        }
+        break;
+    }
+    case Distribution::Gaussian: {
+        double rangeX = area.width() / 6; // 3 sigma should cover 99.7% thus range/6 gives good spread
+        double rangeY = area.height() / 6;
+        std::normal_distribution<> distribX(centerX, rangeX);
+        std::normal_distribution<> distribY(centerY, rangeY);
+        for (int i = 0; i < count; ++i) {
+            // Round the coordinates since QPoint expects integer values
+            out[i] = QPoint(static_cast<int>(distribX(gen)), static_cast<int>(distribY(gen)));
+        }
+        break;
+    }
+    case Distribution::Circle: {
+        double radius = shortSide / 2;
+        std::uniform_real_distribution<> angle(0, 2 * pi);
+        for (int i = 0; i < count; ++i) {
+            double a = angle(gen);
+            out[i] = QPoint(qRound(centerX + radius * std::cos(a)), qRound(centerY + radius * std::sin(a)));
+        }
+        break;
+    }
+    case Distribution::SquareBoundary: {
+        double perimeter = 2 * (area.width() + area.height());
+        std::uniform_real_distribution<> along(0, perimeter);
+        for (int i = 0; i < count; ++i) {
+            double d = along(gen);
+            QPointF p;
+            if (d < area.width())
+                p = QPointF(area.left() + d, area.top());
+            else if ((d -= area.width()) < area.height())
+                p = QPointF(area.right(), area.top() + d);
+            else if ((d -= area.height()) < area.width())
+                p = QPointF(area.right() - d, area.bottom());
+            else
+                p = QPointF(area.left(), area.bottom() - (d - area.width()));
+            out[i] = p.toPoint();
+        }
+        break;
+    }
+    case Distribution::Clusters: {
+        std::uniform_int_distribution<> pick(0, setup.centers.size() - 1);
+        std::normal_distribution<> spread(0, shortSide / 40);
+        for (int i = 0; i < count; ++i) {
+            const QPointF& c = setup.centers[pick(gen)];
+            out[i] = QPoint(static_cast<int>(c.x() + spread(gen)), static_cast<int>(c.y() + spread(gen)));
+        }
+        break;
+    }
+    case Distribution::Duplicates: {
+        std::uniform_int_distribution<> pick(0, setup.locations.size() - 1);
+        for (int i = 0; i < count; ++i) {
+            out[i] = setup.locations[pick(gen)];
+        }
+        break;
+    }
+    case Distribution::NearCollinear: {
+        std::uniform_real_distribution<> along(0, 1);
+        std::uniform_int_distribution<> jitter(-2, 2);
+        for (int i = 0; i < count; ++i) {
+            double t = along(gen);
+            out[i] = QPoint(qRound(area.left() + t * area.width()) + jitter(gen),
+                            qRound(area.top() + t * area.height()) + jitter(gen));
+        }
+        break;
+    }
+    case Distribution::HeavyTail: {
+        // Kuzmin disk: the mass inside radius R is 1 - a / sqrt(R^2 + a^2). The tail is
+        // truncated by resampling so coordinate differences stay small enough for the int
+        // orientation tests.
+        double a = shortSide / 20;
+        double maxRadius = 0.6 * std::max(area.width(), area.height());
+        std::uniform_real_distribution<> mass(0, 1);
+        std::uniform_real_distribution<> angle(0, 2 * pi);
+        for (int i = 0; i < count; ++i) {
+            double r;
+            do {
+                double m = 1 - mass(gen);
+                r = a * std::sqrt(std::max(0.0, 1 / (m * m) - 1));
+            } while (r > maxRadius);
+            double t = angle(gen);
+            out[i] = QPoint(qRound(centerX + r * std::cos(t)), qRound(centerY + r * std::sin(t)));
+        }
+        break;
+    }
+    }
+}
+
+} // namespace
+
+PointGenerator::PointGenerator(Distribution distribution, quint32 seed)
+    : distribution(distribution), seed(seed) {}
+
+QString PointGenerator::name(Distribution distribution) {
+    switch (distribution) {
+    case Distribution::Uniform: return "Uniform";
+    case Distribution::Gaussian: return "Gaussian";
+    case Distribution::Circle: return "Circle";
+    case Distribution::SquareBoundary: return "Square Boundary";
+    case Distribution::Clusters: return "Clusters";
+    case Distribution::Duplicates: return "Duplicates";
+    case Distribution::NearCollinear: return "Near Collinear";
+    case Distribution::HeavyTail: return "Heavy Tail";
+    }
+    return QString();
+}
+
+QVector<PointGenerator::Distribution> PointGenerator::all() {
+    return {Distribution::Uniform, Distribution::Gaussian, Distribution::Circle, Distribution::SquareBoundary,
+            Distribution::Clusters, Distribution::Duplicates, Distribution::NearCollinear, Distribution::HeavyTail};
+}
+
+QVector<QPoint> PointGenerator::generate(int pointCount, const QRectF& area) const {
+    QVector<QPoint> points(std::max(0, pointCount));
+
+    SharedSetup setup;
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<> inX(area.left(), area.right());
+    std::uniform_real_distribution<> inY(area.top(), area.bottom());
+    for (int i = 0; i < ClusterCount; ++i) {
+        setup.centers.append(QPointF(inX(gen), inY(gen)));
+    }
+    for (int i = 0; i < DuplicateLocations; ++i) {
+        setup.locations.append(QPointF(inX(gen), inY(gen)).toPoint());
+    }
+
+    // Chunk c always uses the generator seeded with (seed, c)
+    QPoint* out = points.data();
+    const int chunks = (points.size() + ChunkSize - 1) / ChunkSize;
+    std::atomic<int> nextChunk{0};
+    auto worker = [&]() {
+        for (int c = nextChunk++; c < chunks; c = nextChunk++) {
+            std::seed_seq chunkSeed{seed, static_cast<quint32>(c)};
+            std::mt19937 chunkGen(chunkSeed);
+            int begin = c * ChunkSize;
+            fillChunk(distribution, area, setup, chunkGen, out + begin, std::min<int>(ChunkSize, points.size() - begin));
+        }
+    };
+
+    int threads = std::max(1, std::min({16, chunks, static_cast<int>(std::thread::hardware_concurrency())}));
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& w : workers) {
+        w.join();
+    }
+    return points;
+}
@@ -0,0 +1,45 @@
+#ifndef POINTGENERATOR_H
+#define POINTGENERATOR_H
+
+#include <QVector>
+#include <QPoint>
+#include <QRectF>
+#include <QString>
+
+// Random point sets. The same distribution, seed and area always give the same points.
+//
+// Besides the everyday distributions there are worst cases for the hull algorithms: all
+// points on the hull (Circle), long collinear runs (SquareBoundary, NearCollinear), heavy
+// duplication and a heavy tailed Kuzmin disk. Buffers are filled in fixed size chunks,
+// each with its own generator, so large sets are generated in parallel with results that
+// do not depend on the number of threads.
+class PointGenerator
+{
+public:
+    enum class Distribution {
+        Uniform,
+        Gaussian,
+        Circle,         // On the circle inscribed in the area, every point is on the hull
+                        // until integer rounding saturates the circle
+        SquareBoundary, // On the border of the area
+        Clusters,       // Tight Gaussian blobs
+        Duplicates,     // A few distinct locations, each repeated many times
+        NearCollinear,  // A thin band along the diagonal
+        HeavyTail       // Kuzmin disk, most points in the middle and a long tail
+    };
+
+    PointGenerator(Distribution distribution, quint32 seed);
+
+    QVector<QPoint> generate(int pointCount, const QRectF& area) const;
+
+    static QString name(Distribution distribution);
+    static QVector<Distribution> all();
+
+    static constexpr int ChunkSize = 1 << 16;
+
+private:
+    Distribution distribution;
+    quint32 seed;
+};
+
+#endif // POINTGENERATOR_H
@@ -0,0 +1,80 @@
+#include "progressivehull.h"
+#include "hullutils.h"
+#include <QElapsedTimer>
+
+ProgressiveHull::ProgressiveHull(const QVector<QPoint>& points)
+    : points(points) {
+    const int n = points.size();
+    if (n <= SampleSize) {
+        publish(HullUtils::monotoneChain(points), n);
+        return;
+    }
+
+    QVector<QPoint> sample;
+    sample.reserve(SampleSize);
+    for (int i = 0; i < SampleSize; i++)
+        sample.append(points[static_cast<int>(static_cast<qint64>(n) * i / SampleSize)]);
+    publish(HullUtils::monotoneChain(sample), 0);
+    worker = std::thread(&ProgressiveHull::run, this);
+}
+
+ProgressiveHull::~ProgressiveHull() {
+    cancelled = true;
+    if (worker.joinable())
+        worker.join();
+}
+
+void ProgressiveHull::run() {
+    QVector<QPoint> hull = this->hull();
+    const int n = points.size();
+    QElapsedTimer slice;
+    slice.start();
+    for (int begin = 0; begin < n && !cancelled; begin += ChunkSize) {
+        const int end = std::min(n, begin + ChunkSize);
+
+        // Everything inside the octagon of the hull so far stays inside
+        const QVector<QPoint> octagon = HullUtils::extremeOctagon(hull);
+        QVector<QPoint> merged = hull;
+        for (int i = begin; i < end; i++) {
+            const QPoint& p = points[i];
+            bool inside = octagon.size() >= 3;
+            for (int k = 0; inside && k < octagon.size(); k++)
+                inside = HullUtils::cross(octagon[k], octagon[(k + 1) % octagon.size()], p) > 0;
+            if (!inside)
+                merged.append(p);
+        }
+        hull = HullUtils::monotoneChain(merged);
+
+        if (end == n || slice.nsecsElapsed() >= SliceNs) {
+            publish(hull, end);
+            slice.restart();
+        }
+    }
+}
+
+void ProgressiveHull::publish(const QVector<QPoint>& hull, qint64 coveredPoints) {
+    std::lock_guard<std::mutex> guard(lock);
+    current = hull;
+    covered = coveredPoints;
+    revisions++;
+}
+
+QVector<QPoint> ProgressiveHull::hull() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return current;
+}
+
+int ProgressiveHull::revision() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return revisions;
+}
+
+double ProgressiveHull::progress() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return points.isEmpty() ? 1.0 : static_cast<double>(covered) / points.size();
+}
+
+bool ProgressiveHull::finished() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return covered == points.size();
+}
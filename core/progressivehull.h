@@ -0,0 +1,49 @@
+#ifndef PROGRESSIVEHULL_H
+#define PROGRESSIVEHULL_H
+
+#include <QVector>
+#include <QPoint>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// Anytime convex hull: a rough hull at once, refined on a worker thread until exact.
+//
+// The first estimate is the hull of an evenly spaced sample and is ready when the
+// constructor returns, whatever the input size. The worker then folds the points in
+// chunk by chunk: points inside the octagon of the current hull are skipped, the rest
+// are merged with the hull vertices. Every SliceNs of work the current hull is
+// published, and once every point was folded in it is exact.
+class ProgressiveHull
+{
+public:
+    ProgressiveHull(const QVector<QPoint>& points);
+    ~ProgressiveHull();
+
+    // Latest published hull, counter-clockwise as HullUtils::monotoneChain
+    QVector<QPoint> hull() const;
+    // Increases with every published hull
+    int revision() const;
+    // Fraction of the points the hull covers, 1 once it is exact
+    double progress() const;
+    bool finished() const;
+
+    static constexpr int SampleSize = 4096;
+    static constexpr int ChunkSize = 65536;
+    static constexpr qint64 SliceNs = 16'000'000;
+
+private:
+    QVector<QPoint> points;
+    std::thread worker;
+    std::atomic<bool> cancelled{false};
+
+    mutable std::mutex lock;
+    QVector<QPoint> current;
+    qint64 covered = 0;
+    int revisions = 0;
+
+    void run();
+    void publish(const QVector<QPoint>& hull, qint64 coveredPoints);
+};
+
+#endif // PROGRESSIVEHULL_H
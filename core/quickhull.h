@@ -0,0 +1,121 @@
+#ifndef QUICKHULL_H
+#define QUICKHULL_H
+
+#include <QVector>
+#include <QPoint>
+#include <algorithm>
+
+#include "convexhull.h"
+#include "hullutils.h"
+
+// QuickHull over an index array that is partitioned in place: every recursion only looks
+// at the candidates outside its own edge, and the vertices are emitted in
+// counter-clockwise order as the recursion unwinds, starting at the lowest x.
+class QuickHull : public TracedHull<QuickHull>
+{
+public:
+    QuickHull(const QVector<QPoint>& points)
+        : TracedHull(points) {}
+
+    // Compute the convex hull of the previously given points
+    template <typename Tracer>
+    QVector<QPoint> run(Tracer& tracer)
+    {
+        int n = points.size();
+        if (n < 3)
+            return HullUtils::monotoneChain(points);
+
+        // The lexicographically smallest and largest points are always hull vertices
+        int left = 0, right = 0;
+        for (int i = 1; i < n; i++)
+        {
+            if (HullUtils::lessXY(points[i], points[left]))
+                left = i;
+            if (HullUtils::lessXY(points[right], points[i]))
+                right = i;
+        }
+
+        hull.clear();
+        const QPoint a = points[left];
+        const QPoint b = points[right];
+        if (a == b)
+        {
+            hull.append(a);
+            return hull;
+        }
+
+        // Points below a -> b go to the front of the index array, points above it to the
+        // back. Points on the line can not be vertices and are dropped.
+        indices.resize(n);
+        int lower = 0, upper = n;
+        for (int i = 0; i < n; i++)
+        {
+            qint64 side = HullUtils::cross(a, b, points[i]);
+            if (side < 0)
+                indices[lower++] = i;
+            else if (side > 0)
+                indices[--upper] = i;
+        }
+
+        hull.append(a);
+        quickHull(a, b, 0, lower, tracer);
+        hull.append(b);
+        quickHull(b, a, upper, n, tracer);
+        return hull;
+    }
+
+private:
+    QVector<int> indices;
+    QVector<QPoint> hull;
+
+    // Appends the hull vertices strictly between p and q, given that indices[begin..end)
+    // holds exactly the points right of p -> q
+    template <typename Tracer>
+    void quickHull(QPoint p, QPoint q, int begin, int end, Tracer& tracer)
+    {
+        tracer.test(p, q);
+        if (begin == end)
+        {
+            tracer.accept(p, q);
+            return;
+        }
+
+        // Farthest candidate from the line p -> q. Of several equally far candidates the
+        // one closest to p is taken, so the others are not emitted as collinear vertices.
+        int farthest = begin;
+        qint64 maxDist = 0;
+        qint64 maxAlong = 0;
+        for (int i = begin; i < end; i++)
+        {
+            const QPoint& r = points[indices[i]];
+            qint64 dist = -HullUtils::cross(p, q, r);
+            qint64 along = static_cast<qint64>(r.x() - p.x()) * (q.x() - p.x()) +
+                           static_cast<qint64>(r.y() - p.y()) * (q.y() - p.y());
+            if (dist > maxDist || (dist == maxDist && along < maxAlong))
+            {
+                farthest = i;
+                maxDist = dist;
+                maxAlong = along;
+            }
+        }
+        const QPoint c = points[indices[farthest]];
+
+        // Candidates outside p -> c first, then those outside c -> q. Everything else is
+        // inside the triangle p, c, q and is dropped.
+        int* first = indices.data() + begin;
+        int* last = indices.data() + end;
+        int* mid = std::partition(first, last, [&](int i) {
+            return HullUtils::cross(p, c, points[i]) < 0;
+        });
+        int* stop = std::partition(mid, last, [&](int i) {
+            return HullUtils::cross(c, q, points[i]) < 0;
+        });
+
+        const int split = static_cast<int>(mid - indices.data());
+        quickHull(p, c, begin, split, tracer);
+        hull.append(c);
+        quickHull(c, q, split, static_cast<int>(stop - indices.data()), tracer);
+    }
+};
+
+#endif
@@ -0,0 +1,339 @@
+#include "quickhull3d.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// QuickHull over a subset of the points.
+// Faces are triangles stored in a compact half-edge form: half-edge h = 3 * face + i runs
+// from v[i] to v[(i + 1) % 3], next(h) stays inside the face and twin[h] is the opposite half-edge.
+class HullBuilder
+{
+public:
+    HullBuilder(const QVector<Point3D>& points) : points(points) {}
+
+    // Returns false if the candidates do not span a volume
+    bool build(const QVector<int>& candidates)
+    {
+        faces.clear();
+        twin.clear();
+        if (candidates.size() < 4)
+            return false;
+
+        double maxX = 0, maxY = 0, maxZ = 0;
+        for (int i : candidates) {
+            maxX = std::max(maxX, std::fabs(points[i].x));
+            maxY = std::max(maxY, std::fabs(points[i].y));
+            maxZ = std::max(maxZ, std::fabs(points[i].z));
+        }
+        eps = 3 * DBL_EPSILON * (maxX + maxY + maxZ);
+
+        int simplex[4];
+        if (!initialSimplex(candidates, simplex))
+            return false;
+
+        // Every remaining point goes into the outside set of the face it is furthest above
+        QVector<int> firstFaces{0, 1, 2, 3};
+        for (int i : candidates) {
+            if (i != simplex[0] && i != simplex[1] && i != simplex[2] && i != simplex[3])
+                assignPoint(i, firstFaces);
+        }
+
+        // New faces are appended, so a single pass reaches every face with an outside set
+        for (int f = 0; f < faces.size(); f++) {
+            if (faces[f].alive && !faces[f].outside.isEmpty())
+                addPoint(f);
+        }
+        return true;
+    }
+
+    QVector<Face3D> hullFaces() const
+    {
+        QVector<Face3D> result;
+        for (const Face& f : faces) {
+            if (f.alive)
+                result.append(Face3D{f.v[0], f.v[1], f.v[2]});
+        }
+        return result;
+    }
+
+    QVector<int> hullVertices() const
+    {
+        QVector<int> vertices;
+        for (const Face& f : faces) {
+            if (f.alive)
+                vertices << f.v[0] << f.v[1] << f.v[2];
+        }
+        std::sort(vertices.begin(), vertices.end());
+        vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+        return vertices;
+    }
+
+private:
+    struct Face {
+        int v[3];
+        double nx, ny, nz, d; // Outward unit normal and offset, n.p = d on the plane
+        QVector<int> outside; // Points above this face (its conflict list)
+        int furthest = -1;
+        double furthestDist = 0;
+        int visit = 0;
+        bool alive = true;
+    };
+
+    const QVector<Point3D>& points;
+    QVector<Face> faces;
+    QVector<int> twin;
+    double eps = 0;
+    int visitMark = 0;
+
+    static int next(int h) { return h % 3 == 2 ? h - 2 : h + 1; }
+    int origin(int h) const { return faces[h / 3].v[h % 3]; }
+
+    double distance(const Face& f, int p) const
+    {
+        return f.nx * points[p].x + f.ny * points[p].y + f.nz * points[p].z - f.d;
+    }
+
+    int addFace(int a, int b, int c)
+    {
+        const Point3D& pa = points[a];
+        const Point3D& pb = points[b];
+        const Point3D& pc = points[c];
+        double ux = pb.x - pa.x, uy = pb.y - pa.y, uz = pb.z - pa.z;
+        double wx = pc.x - pa.x, wy = pc.y - pa.y, wz = pc.z - pa.z;
+
+        Face f;
+        f.v[0] = a;
+        f.v[1] = b;
+        f.v[2] = c;
+        f.nx = uy * wz - uz * wy;
+        f.ny = uz * wx - ux * wz;
+        f.nz = ux * wy - uy * wx;
+        double len = std::sqrt(f.nx * f.nx + f.ny * f.ny + f.nz * f.nz);
+        if (len > 0) {
+            f.nx /= len;
+            f.ny /= len;
+            f.nz /= len;
+        }
+        f.d = f.nx * pa.x + f.ny * pa.y + f.nz * pa.z;
+
+        faces.append(f);
+        twin.append(-1);
+        twin.append(-1);
+        twin.append(-1);
+        return faces.size() - 1;
+    }
+
+    void linkTwins(int h1, int h2)
+    {
+        twin[h1] = h2;
+        twin[h2] = h1;
+    }
+
+    void assignPoint(int p, const QVector<int>& candidateFaces)
+    {
+        int best = -1;
+        double bestDist = eps;
+        for (int f : candidateFaces) {
+            double dist = distance(faces[f], p);
+            if (dist > bestDist) {
+                best = f;
+                bestDist = dist;
+            }
+        }
+        if (best == -1)
+            return; // Inside the hull, discard for good
+
+        Face& f = faces[best];
+        f.outside.append(p);
+        if (bestDist > f.furthestDist) {
+            f.furthest = p;
+            f.furthestDist = bestDist;
+        }
+    }
+
+    bool initialSimplex(const QVector<int>& candidates, int simplex[4])
+    {
+        // Extreme points along each axis, the most distant pair becomes the first edge
+        int minIdx[3], maxIdx[3];
+        std::fill(minIdx, minIdx + 3, candidates[0]);
+        std::fill(maxIdx, maxIdx + 3, candidates[0]);
+        auto coord = [this](int i, int axis) {
+            return axis == 0 ? points[i].x : axis == 1 ? points[i].y : points[i].z;
+        };
+        for (int i : candidates) {
+            for (int axis = 0; axis < 3; axis++) {
+                if (coord(i, axis) < coord(minIdx[axis], axis)) minIdx[axis] = i;
+                if (coord(i, axis) > coord(maxIdx[axis], axis)) maxIdx[axis] = i;
+            }
+        }
+        int axis = 0;
+        for (int a = 1; a < 3; a++) {
+            if (coord(maxIdx[a], a) - coord(minIdx[a], a) > coord(maxIdx[axis], axis) - coord(minIdx[axis], axis))
+                axis = a;
+        }
+        int v0 = minIdx[axis], v1 = maxIdx[axis];
+        if (coord(v1, axis) - coord(v0, axis) <= eps)
+            return false;
+
+        // Furthest point from the line v0 v1
+        const Point3D& p0 = points[v0];
+        double dx = points[v1].x - p0.x, dy = points[v1].y - p0.y, dz = points[v1].z - p0.z;
+        int v2 = -1;
+        double best = 0;
+        for (int i : candidates) {
+            double ex = points[i].x - p0.x, ey = points[i].y - p0.y, ez = points[i].z - p0.z;
+            double cx = dy * ez - dz * ey, cy = dz * ex - dx * ez, cz = dx * ey - dy * ex;
+            double d = cx * cx + cy * cy + cz * cz;
+            if (d > best) {
+                best = d;
+                v2 = i;
+            }
+        }
+        if (v2 == -1 || std::sqrt(best) / std::sqrt(dx * dx + dy * dy + dz * dz) <= eps)
+            return false;
+
+        // Furthest point from the plane v0 v1 v2
+        int base = addFace(v0, v1, v2);
+        int v3 = -1;
+        best = 0;
+        for (int i : candidates) {
+            double d = std::fabs(distance(faces[base], i));
+            if (d > best) {
+                best = d;
+                v3 = i;
+            }
+        }
+        if (v3 == -1 || best <= eps)
+            return false;
+
+        // The first face has to point away from the apex
+        bool apexAbove = distance(faces[base], v3) > 0;
+        faces.clear();
+        twin.clear();
+        if (apexAbove)
+            std::swap(v1, v2);
+
+        addFace(v0, v1, v2);
+        addFace(v0, v3, v1);
+        addFace(v1, v3, v2);
+        addFace(v2, v3, v0);
+        for (int h1 = 0; h1 < 12; h1++) {
+            for (int h2 = h1 + 1; h2 < 12; h2++) {
+                if (origin(h1) == origin(next(h2)) && origin(h2) == origin(next(h1)))
+                    linkTwins(h1, h2);
+            }
+        }
+
+        simplex[0] = v0;
+        simplex[1] = v1;
+        simplex[2] = v2;
+        simplex[3] = v3;
+        return true;
+    }
+
+    void addPoint(int faceIndex)
+    {
+        const int eye = faces[faceIndex].furthest;
+        const int mark = ++visitMark;
+
+        // Depth first walk over the faces visible from the eye. Horizon edges come out in
+        // counter-clockwise order because each face is left through the edges following
+        // the one it was entered by.
+        struct Frame { int edge; int remaining; };
+        QVector<int> visible{faceIndex};
+        QVector<int> horizon;
+        QVector<Frame> stack{Frame{3 * faceIndex, 3}};
+        faces[faceIndex].visit = mark;
+        while (!stack.isEmpty()) {
+            Frame& top = stack.last();
+            if (top.remaining == 0) {
+                stack.removeLast();
+                continue;
+            }
+            int e = top.edge;
+            top.edge = next(e);
+            top.remaining--;
+
+            int t = twin[e];
+            Face& neighbour = faces[t / 3];
+            if (neighbour.visit == mark)
+                continue;
+            if (distance(neighbour, eye) > eps) {
+                neighbour.visit = mark;
+                visible.append(t / 3);
+                stack.append(Frame{next(t), 2});
+            } else {
+                horizon.append(e);
+            }
+        }
+
+        // Cone of new faces from the horizon to the eye
+        QVector<int> newFaces;
+        newFaces.reserve(horizon.size());
+        for (int e : horizon) {
+            int a = origin(e);
+            int b = origin(next(e));
+            int outer = twin[e];
+            int f = addFace(a, b, eye);
+            linkTwins(3 * f, outer);
+            newFaces.append(f);
+        }
+        for (int i = 0; i < newFaces.size(); i++) {
+            int following = newFaces[(i + 1) % newFaces.size()];
+            linkTwins(3 * newFaces[i] + 1, 3 * following + 2);
+        }
+
+        // Hand the conflict lists of the removed faces over to the new ones
+        for (int f : visible) {
+            QVector<int> orphans;
+            orphans.swap(faces[f].outside);
+            faces[f].alive = false;
+            for (int p : orphans) {
+                if (p != eye)
+                    assignPoint(p, newFaces);
+            }
+        }
+    }
+};
+
+} // namespace
+
+QuickHull3D::QuickHull3D(const QVector<Point3D>& points)
+    : points(points) {}
+
+QVector<Face3D> QuickHull3D::compute() {
+    QVector<int> candidates(points.size());
+    std::iota(candidates.begin(), candidates.end(), 0);
+
+    int threads = std::max(1, std::min(16, static_cast<int>(std::thread::hardware_concurrency())));
+    if (points.size() >= ParallelThreshold && threads > 1) {
+        // Only vertices of the slice hulls can be vertices of the full hull
+        QVector<QVector<int>> partial(threads);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([this, t, threads, &candidates, &partial]() {
+                int begin = static_cast<int>(static_cast<qint64>(candidates.size()) * t / threads);
+                int end = static_cast<int>(static_cast<qint64>(candidates.size()) * (t + 1) / threads);
+                QVector<int> slice(candidates.begin() + begin, candidates.begin() + end);
+                HullBuilder builder(points);
+                partial[t] = builder.build(slice) ? builder.hullVertices() : slice;
+            });
+        }
+        for (std::thread& worker : workers)
+            worker.join();
+
+        candidates.clear();
+        for (const QVector<int>& vertices : partial)
+            candidates += vertices;
+    }
+
+    HullBuilder builder(points);
+    if (!builder.build(candidates))
+        return QVector<Face3D>();
+    return builder.hullFaces();
+}
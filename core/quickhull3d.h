@@ -0,0 +1,35 @@
+#ifndef QUICKHULL3D_H
+#define QUICKHULL3D_H
+
+#include <QVector>
+
+struct Point3D {
+    double x;
+    double y;
+    double z;
+};
+
+// Hull triangle as indices into the input points, counter-clockwise seen from outside
+struct Face3D {
+    int a;
+    int b;
+    int c;
+};
+
+class QuickHull3D
+{
+public:
+    QuickHull3D(const QVector<Point3D>& points);
+
+    // Compute the convex hull as outward facing triangles.
+    // Returns an empty list if all points are coplanar.
+    QVector<Face3D> compute();
+
+    // Inputs at least this large are split into slices whose hulls are built in parallel
+    static constexpr int ParallelThreshold = 200'000;
+
+private:
+    QVector<Point3D> points;
+};
+
+#endif // QUICKHULL3D_H
@@ -0,0 +1,207 @@
+#include "regressiongate.h"
+#include "hullutils.h"
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRectF>
+#include <QStringList>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+double median(QVector<double> values) {
+    std::sort(values.begin(), values.end());
+    int n = values.size();
+    return n % 2 == 1 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+// True if every point of the result lies on the boundary of its own hull
+bool isHullShaped(const QVector<QPoint>& result) {
+    QVector<QPoint> hull = HullUtils::monotoneChain(result);
+    if (hull.size() < 3)
+        return true;
+    for (const QPoint& p : result) {
+        bool onBoundary = false;
+        for (int i = 0; i < hull.size() && !onBoundary; i++) {
+            const QPoint& a = hull[i];
+            const QPoint& b = hull[(i + 1) % hull.size()];
+            onBoundary = HullUtils::cross(a, b, p) == 0 &&
+                         std::min(a.x(), b.x()) <= p.x() && p.x() <= std::max(a.x(), b.x()) &&
+                         std::min(a.y(), b.y()) <= p.y() && p.y() <= std::max(a.y(), b.y());
+        }
+        if (!onBoundary)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+RegressionGate::RegressionGate(const Options& options)
+    : options(options) {}
+
+QString RegressionGate::checksum(const QVector<QPoint>& hull) {
+    // FNV-1a over the canonical hull: counter-clockwise from the lowest x
+    quint64 hash = 14695981039346656037ULL;
+    for (const QPoint& p : HullUtils::monotoneChain(hull)) {
+        const qint32 xy[2] = {p.x(), p.y()};
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(xy);
+        for (std::size_t i = 0; i < sizeof(xy); i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+    return QString::number(hash, 16);
+}
+
+QString RegressionGate::key(HullAlgorithm algorithm, PointGenerator::Distribution distribution, int size) {
+    return QString("%1/%2/%3").arg(hullAlgorithmName(algorithm), PointGenerator::name(distribution)).arg(size);
+}
+
+bool RegressionGate::run() {
+    using Distribution = PointGenerator::Distribution;
+    const QRectF area(0, 0, 19200, 10800);
+    const QVector<HullAlgorithm> algorithms{HullAlgorithm::G, HullAlgorithm::J, HullAlgorithm::Q,
+                                            HullAlgorithm::M, HullAlgorithm::A, HullAlgorithm::P};
+    const QVector<Distribution> distributions = PointGenerator::all();
+    const QVector<int> sizes{10'000, 100'000, 1'000'000};
+
+    QMap<QString, Result> baseline;
+    bool record = options.updateBaseline || !QFile::exists(options.baselinePath);
+    if (!record && !loadBaseline(baseline))
+        return false;
+    if (record)
+        qInfo().noquote() << "Recording baseline" << options.baselinePath;
+
+    QMap<QString, Result> results;
+    bool passed = true;
+    for (Distribution distribution : distributions) {
+        for (int size : sizes) {
+            quint32 seed = static_cast<quint32>(size) * 31 + static_cast<quint32>(distribution);
+            QVector<QPoint> points = PointGenerator(distribution, seed).generate(size, area);
+            QString reference = checksum(HullUtils::monotoneChain(points));
+
+            for (HullAlgorithm algorithm : algorithms) {
+                // O(nh) with h in the thousands would dominate the whole run
+                if (algorithm == HullAlgorithm::J && distribution == Distribution::Circle && size > 100'000)
+                    continue;
+
+                QVector<double> times;
+                QVector<QPoint> hull;
+                for (int r = 0; r < options.repetitions; r++) {
+                    ConvexHull* hullAlgorithm = createHull(algorithm, points);
+                    QElapsedTimer timer;
+                    timer.start();
+                    hull = hullAlgorithm->compute();
+                    times.append(timer.nsecsElapsed() / 1e6);
+                    delete hullAlgorithm;
+                }
+
+                Result result;
+                result.medianMs = median(times);
+                QVector<double> deviations;
+                for (double t : times)
+                    deviations.append(std::fabs(t - result.medianMs));
+                result.madMs = median(deviations);
+                result.checksum = checksum(hull);
+
+                const QString name = key(algorithm, distribution, size);
+                results.insert(name, result);
+
+                QStringList problems;
+                if (!isHullShaped(hull))
+                    problems << "result contains interior points";
+                if (isExactHull(algorithm) && result.checksum != reference)
+                    problems << "hull differs from the reference hull";
+                QString comparison;
+                if (!record && baseline.contains(name)) {
+                    const Result& base = baseline[name];
+                    // Slowdowns inside the run to run noise of either measurement are not counted
+                    double allowed = base.medianMs * (1 + options.threshold) + 3 * std::max(base.madMs, result.madMs);
+                    comparison = QString(" (baseline %1 ms)").arg(base.medianMs, 0, 'f', 2);
+                    if (result.medianMs > allowed)
+                        problems << QString("slower than the allowed %1 ms").arg(allowed, 0, 'f', 2);
+                    if (result.checksum != base.checksum)
+                        problems << "hull differs from the baseline";
+                } else if (!record) {
+                    comparison = " (not in baseline)";
+                }
+
+                QString line = QString("%1: %2 ms +- %3%4").arg(name).arg(result.medianMs, 0, 'f', 2)
+                                   .arg(result.madMs, 0, 'f', 2).arg(comparison);
+                if (problems.isEmpty()) {
+                    qInfo().noquote() << "PASS" << line;
+                } else {
+                    qWarning().noquote() << "FAIL" << line << "-" << problems.join(", ");
+                    passed = false;
+                }
+            }
+        }
+    }
+
+    if (record && !saveBaseline(results))
+        return false;
+    qInfo().noquote() << (passed ? "Regression gate passed" : "Regression gate failed");
+    return passed;
+}
+
+bool RegressionGate::loadBaseline(QMap<QString, Result>& baseline) const {
+    QFile file(options.baselinePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning().noquote() << "Cannot read baseline" << options.baselinePath;
+        return false;
+    }
+    QJsonParseError parseError;
+    QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (document.isNull()) {
+        qWarning().noquote() << "Invalid baseline" << options.baselinePath << parseError.errorString();
+        return false;
+    }
+
+    QJsonObject root = document.object();
+    if (root.value("version").toInt() != FormatVersion) {
+        qWarning().noquote() << "Baseline" << options.baselinePath << "has format version"
+                             << root.value("version").toInt() << "but" << FormatVersion
+                             << "is needed, rerun with --update-baseline";
+        return false;
+    }
+    for (const QJsonValue& value : root.value("cases").toArray()) {
+        QJsonObject entry = value.toObject();
+        Result result;
+        result.medianMs = entry.value("median_ms").toDouble();
+        result.madMs = entry.value("mad_ms").toDouble();
+        result.checksum = entry.value("checksum").toString();
+        baseline.insert(entry.value("key").toString(), result);
+    }
+    return true;
+}
+
+bool RegressionGate::saveBaseline(const QMap<QString, Result>& results) const {
+    QJsonArray cases;
+    for (auto it = results.constBegin(); it != results.constEnd(); ++it) {
+        QJsonObject entry;
+        entry.insert("key", it.key());
+        entry.insert("median_ms", it.value().medianMs);
+        entry.insert("mad_ms", it.value().madMs);
+        entry.insert("checksum", it.value().checksum);
+        cases.append(entry);
+    }
+    QJsonObject root;
+    root.insert("version", FormatVersion);
+    root.insert("cases", cases);
+
+    QDir().mkpath(QFileInfo(options.baselinePath).absolutePath());
+    QFile file(options.baselinePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning().noquote() << "Cannot write baseline" << options.baselinePath;
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson());
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef REGRESSIONGATE_H
+#define REGRESSIONGATE_H
+
+#include <QVector>
+#include <QPoint>
+#include <QString>
+#include <QMap>
+
+#include "hullalgorithms.h"
+#include "pointgenerator.h"
+
+// Performance regression gate.
+//
+// Runs a fixed, seeded matrix of algorithm x distribution x size and compares median
+// runtimes and hull checksums against a baseline file. A case fails if it is slower than
+// the baseline by more than the threshold and by more than the measured noise, if its hull
+// differs from the baseline, or if the exact algorithms disagree on a hull.
+class RegressionGate
+{
+public:
+    struct Options {
+        QString baselinePath = "benchmarks/baseline.json";
+        bool updateBaseline = false; // Record this run as the new baseline
+        double threshold = 0.10;     // Allowed relative slowdown
+        int repetitions = 7;
+    };
+
+    RegressionGate(const Options& options);
+
+    // Returns true if the gate passes
+    bool run();
+
+    // Bumped whenever the matrix or the file layout changes
+    static constexpr int FormatVersion = 2;
+
+    // Order independent checksum of a hull, duplicates and collinear points ignored
+    static QString checksum(const QVector<QPoint>& hull);
+
+private:
+    struct Result {
+        double medianMs = 0;
+        double madMs = 0; // Median absolute deviation
+        QString checksum;
+    };
+
+    Options options;
+
+    static QString key(HullAlgorithm algorithm, PointGenerator::Distribution distribution, int size);
+    bool loadBaseline(QMap<QString, Result>& baseline) const;
+    bool saveBaseline(const QMap<QString, Result>& results) const;
+};
+
+#endif // REGRESSIONGATE_H
@@ -0,0 +1,141 @@
+#include "rotatingcalipers.h"
+#include "hullutils.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace {
+
+qint64 dot(const QPoint& o, const QPoint& a, const QPoint& b) {
+    return static_cast<qint64>(a.x() - o.x()) * (b.x() - o.x()) +
+           static_cast<qint64>(a.y() - o.y()) * (b.y() - o.y());
+}
+
+qint64 squaredDistance(const QPoint& a, const QPoint& b) {
+    return dot(a, b, b);
+}
+
+// Counter-clockwise vertices without repeated or collinear points, whatever the
+// orientation and start of the input
+QVector<QPoint> strictlyConvex(const QVector<QPoint>& hull) {
+    QVector<QPoint> polygon;
+    polygon.reserve(hull.size());
+    for (const QPoint& p : hull) {
+        if (polygon.isEmpty() || polygon.last() != p)
+            polygon.append(p);
+    }
+    while (polygon.size() > 1 && polygon.first() == polygon.last())
+        polygon.removeLast();
+
+    qint64 area = 0;
+    for (int i = 1; i + 1 < polygon.size(); i++)
+        area += HullUtils::cross(polygon[0], polygon[i], polygon[i + 1]);
+    if (area < 0)
+        std::reverse(polygon.begin(), polygon.end());
+    if (area == 0) {
+        // All points on one line: keep its two ends
+        if (polygon.size() <= 2)
+            return polygon;
+        auto ends = std::minmax_element(polygon.begin(), polygon.end(), HullUtils::lessXY);
+        return QVector<QPoint>{*ends.first, *ends.second};
+    }
+
+    QVector<QPoint> convex;
+    convex.reserve(polygon.size());
+    const int n = polygon.size();
+    for (int i = 0; i < n; i++) {
+        const QPoint& prev = polygon[(i + n - 1) % n];
+        const QPoint& next = polygon[(i + 1) % n];
+        if (HullUtils::cross(prev, polygon[i], next) != 0)
+            convex.append(polygon[i]);
+    }
+    return convex;
+}
+
+} // namespace
+
+HullMetrics RotatingCalipers::measure(const QVector<QPoint>& hull) {
+    HullMetrics metrics;
+    const QVector<QPoint> p = strictlyConvex(hull);
+    const int h = p.size();
+    if (h == 0)
+        return metrics;
+    if (h <= 2) {
+        metrics.diameterFrom = p.first();
+        metrics.diameterTo = p.last();
+        metrics.diameter = std::sqrt(static_cast<double>(squaredDistance(p.first(), p.last())));
+        metrics.rectangle = {p.first(), p.last(), p.last(), p.first()};
+        return metrics;
+    }
+
+    auto next = [h](int i) { return i + 1 == h ? 0 : i + 1; };
+
+    qint64 bestDiameter = -1;
+    auto diameterCandidate = [&](const QPoint& a, const QPoint& b) {
+        qint64 d = squaredDistance(a, b);
+        if (d > bestDiameter) {
+            bestDiameter = d;
+            metrics.diameterFrom = a;
+            metrics.diameterTo = b;
+        }
+    };
+
+    // For the edge from p[i] to p[i + 1]: top is the vertex farthest from the edge, right
+    // and left are the extreme vertices along its direction
+    int top = 1, right = 1, left = 0;
+    metrics.width = INFINITY;
+    metrics.rectangleArea = INFINITY;
+    for (int i = 0; i < h; i++) {
+        const QPoint& a = p[i];
+        const QPoint& b = p[next(i)];
+        if (i == 0)
+            right = next(i);
+        while (dot(a, b, p[next(right)]) > dot(a, b, p[right]))
+            right = next(right);
+        if (i == 0)
+            top = right;
+        while (HullUtils::cross(a, b, p[next(top)]) > HullUtils::cross(a, b, p[top]))
+            top = next(top);
+        if (i == 0)
+            left = top;
+        while (dot(a, b, p[next(left)]) < dot(a, b, p[left]))
+            left = next(left);
+
+        diameterCandidate(a, p[top]);
+        diameterCandidate(b, p[top]);
+
+        const double length2 = static_cast<double>(squaredDistance(a, b));
+        const double height = HullUtils::cross(a, b, p[top]);
+        metrics.width = std::min(metrics.width, height / std::sqrt(length2));
+
+        const double low = dot(a, b, p[left]);
+        const double high = dot(a, b, p[right]);
+        const double area = (high - low) * height / length2;
+        if (area < metrics.rectangleArea) {
+            metrics.rectangleArea = area;
+            const QPointF along(b - a);
+            const QPointF normal(a.y() - b.y(), b.x() - a.x());
+            const QPointF start = QPointF(a) + along * (low / length2);
+            const QPointF end = QPointF(a) + along * (high / length2);
+            const QPointF up = normal * (height / length2);
+            metrics.rectangle = {start, end, end + up, start + up};
+        }
+    }
+    metrics.diameter = std::sqrt(static_cast<double>(bestDiameter));
+    return metrics;
+}
+
+QVector<HullMetrics> RotatingCalipers::measureAll(const QVector<QVector<QPoint>>& hulls) {
+    QVector<HullMetrics> results(hulls.size());
+    qint64 vertices = 0;
+    for (const QVector<QPoint>& hull : hulls)
+        vertices += hull.size();
+
+    int threads = HullUtils::workerCount(static_cast<int>(std::min<qint64>(vertices, INT_MAX)), ParallelThreshold);
+    threads = std::max(1, std::min(threads, static_cast<int>(hulls.size())));
+    HullUtils::forSlices(hulls.size(), threads, [&](int begin, int end, int) {
+        for (int i = begin; i < end; i++)
+            results[i] = measure(hulls[i]);
+    });
+    return results;
+}
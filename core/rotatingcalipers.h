@@ -0,0 +1,32 @@
+#ifndef ROTATINGCALIPERS_H
+#define ROTATINGCALIPERS_H
+
+#include <QVector>
+#include <QPoint>
+#include <QPointF>
+
+// Shape measures of a convex hull
+struct HullMetrics {
+    double diameter = 0.0;          // Largest distance between two vertices
+    QPoint diameterFrom;
+    QPoint diameterTo;
+    double width = 0.0;             // Smallest distance between two parallel supporting lines
+    double rectangleArea = 0.0;     // Area of the minimum-area enclosing rectangle
+    QVector<QPointF> rectangle;     // Its corners, counter-clockwise
+};
+
+// Rotating calipers over the vertices of a hull in cyclic order, as returned by any
+// ConvexHull. Every caliper only moves forward around the hull, so each hull costs O(h).
+namespace RotatingCalipers {
+
+HullMetrics measure(const QVector<QPoint>& hull);
+
+// measure() for many hulls, spread over several threads when there are enough of them
+QVector<HullMetrics> measureAll(const QVector<QVector<QPoint>>& hulls);
+
+// Batches with at least this many vertices in total are measured on several threads
+constexpr int ParallelThreshold = 100'000;
+
+} // namespace RotatingCalipers
+
+#endif // ROTATINGCALIPERS_H
@@ -0,0 +1,232 @@
+#include "shardedhull.h"
+#include "hullutils.h"
+#include "hullwire.h"
+#include <QtGlobal>
+#include <algorithm>
+#include <limits>
+
+#ifdef Q_OS_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+ShardedHull::ShardedHull(int workers)
+    : workers(std::max(1, workers)) {}
+
+QVector<QPoint> ShardedHull::hull() const {
+    return result;
+}
+
+qint64 ShardedHull::pointCount() const {
+    return count;
+}
+
+QString ShardedHull::errorString() const {
+    return error;
+}
+
+#ifdef Q_OS_LINUX
+
+bool ShardedHull::mapBinary(const QString& path) {
+    int fd = ::open(path.toLocal8Bit().constData(), O_RDONLY);
+    if (fd < 0) {
+        error = QString("Cannot open %1").arg(path);
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size % (2 * sizeof(qint32)) != 0) {
+        ::close(fd);
+        error = QString("%1 is not a list of qint32 x, y pairs").arg(path);
+        return false;
+    }
+
+    // The file itself is the shared buffer, nothing is copied
+    count = info.st_size / (2 * sizeof(qint32));
+    mappingLength = static_cast<std::size_t>(info.st_size);
+    if (mappingLength > 0) {
+        mapping = ::mmap(nullptr, mappingLength, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        error = QString("Cannot map %1").arg(path);
+        return false;
+    }
+    xy = static_cast<const qint32*>(mapping);
+    return true;
+}
+
+bool ShardedHull::mapText(const QString& path) {
+    int fd = ::open(path.toLocal8Bit().constData(), O_RDONLY);
+    if (fd < 0) {
+        error = QString("Cannot open %1").arg(path);
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        error = QString("%1 is empty").arg(path);
+        return false;
+    }
+    std::size_t textLength = static_cast<std::size_t>(info.st_size);
+    void* text = ::mmap(nullptr, textLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (text == MAP_FAILED) {
+        error = QString("Cannot map %1").arg(path);
+        return false;
+    }
+
+    // Parse straight into an anonymous shared buffer. A point takes at least four
+    // characters ("0 0\n"), which bounds the size; untouched pages are never allocated.
+    mappingLength = (textLength / 4 + 1) * 2 * sizeof(qint32);
+    mapping = ::mmap(nullptr, mappingLength, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        ::munmap(text, textLength);
+        error = "Cannot allocate shared memory";
+        return false;
+    }
+
+    qint32* out = static_cast<qint32*>(mapping);
+    const qint64 capacity = static_cast<qint64>(mappingLength / sizeof(qint32));
+    qint64 values = 0;
+    const char* begin = static_cast<const char*>(text);
+    const char* c = begin;
+    const char* end = c + textLength;
+    while (c < end && error.isEmpty()) {
+        if (*c == '#') {
+            // Comment up to the end of the line
+            while (c < end && *c != '\n')
+                c++;
+            continue;
+        }
+        if (*c != '-' && *c != '.' && (*c < '0' || *c > '9')) {
+            c++;
+            continue;
+        }
+        const char* start = c;
+        bool negative = *c == '-';
+        if (negative)
+            c++;
+        qint64 value = 0;
+        const qint64 limit = static_cast<qint64>(std::numeric_limits<qint32>::max()) + negative;
+        while (c < end && *c >= '0' && *c <= '9')
+            value = std::min(value * 10 + (*c++ - '0'), limit + 1);
+        if (c == start + negative || value > limit || (c < end && (*c == '-' || *c == '.'))) {
+            // Signs without digits, decimals and out of range values are not qint32 coordinates
+            error = QString("%1: invalid number at byte %2").arg(path).arg(static_cast<qint64>(start - begin));
+        } else if (values == capacity) {
+            error = QString("%1 has more numbers than fit its size").arg(path);
+        } else {
+            out[values++] = static_cast<qint32>(negative ? -value : value);
+        }
+    }
+    ::munmap(text, textLength);
+    if (error.isEmpty() && values % 2 != 0)
+        error = QString("%1 has an x without a y").arg(path);
+    if (!error.isEmpty())
+        return false;
+
+    count = values / 2;
+    xy = out;
+    return true;
+}
+
+void ShardedHull::unmap() {
+    if (mapping)
+        ::munmap(mapping, mappingLength);
+    mapping = nullptr;
+    xy = nullptr;
+    mappingLength = 0;
+}
+
+bool ShardedHull::compute(const QString& path) {
+    result.clear();
+    error.clear();
+    bool text = path.endsWith(".txt") || path.endsWith(".csv");
+    if (!(text ? mapText(path) : mapBinary(path))) {
+        unmap();
+        return false;
+    }
+
+    // Small inputs are not worth a process each
+    int shards = static_cast<int>(std::min<qint64>(workers, std::max<qint64>(1, count / 4096)));
+
+    struct Worker { pid_t pid; int fd; };
+    QVector<Worker> running;
+    for (int s = 0; s < shards; s++) {
+        int channel[2];
+        if (::pipe(channel) != 0) {
+            error = "Cannot create pipe";
+            break;
+        }
+        pid_t pid = ::fork();
+        if (pid < 0) {
+            ::close(channel[0]);
+            ::close(channel[1]);
+            error = "Cannot start worker process";
+            break;
+        }
+        if (pid == 0) {
+            // Worker: hull of one shard, read in place from the shared buffer. Only the
+            // points not strictly inside the octagon of the shard's extremes are copied
+            // out to be sorted.
+            ::close(channel[0]);
+            const qint64 begin = count * s / shards;
+            const qint64 end = count * (s + 1) / shards;
+            auto at = [this, begin](qint64 i) { return QPoint(xy[2 * (begin + i)], xy[2 * (begin + i) + 1]); };
+            const QVector<QPoint> octagon = HullUtils::extremeOctagon(end - begin, at);
+            QVector<QPoint> outside;
+            for (qint64 i = 0; i < end - begin; i++) {
+                const QPoint p = at(i);
+                bool interior = octagon.size() >= 3;
+                for (int k = 0; interior && k < octagon.size(); k++)
+                    interior = HullUtils::cross(octagon[k], octagon[(k + 1) % octagon.size()], p) > 0;
+                if (!interior)
+                    outside.append(p);
+            }
+            bool sent = HullWire::writeHull(channel[1], HullUtils::monotoneChain(outside));
+            ::_exit(sent ? 0 : 1);
+        }
+        ::close(channel[1]);
+        running.append(Worker{pid, channel[0]});
+    }
+
+    // Coordinator: collect and merge the partial hulls
+    QVector<QVector<QPoint>> partial;
+    for (const Worker& worker : running) {
+        QVector<QPoint> shardHull;
+        if (HullWire::readHull(worker.fd, shardHull))
+            partial.append(shardHull);
+        else if (error.isEmpty())
+            error = "Worker process failed";
+        ::close(worker.fd);
+    }
+    for (const Worker& worker : running) {
+        int status = 0;
+        ::waitpid(worker.pid, &status, 0);
+    }
+    unmap();
+
+    if (!error.isEmpty())
+        return false;
+    result = HullUtils::mergeHulls(partial);
+    return true;
+}
+
+#else
+
+bool ShardedHull::compute(const QString& path) {
+    Q_UNUSED(path);
+    error = "Sharded hulls need Linux";
+    return false;
+}
+
+bool ShardedHull::mapBinary(const QString&) { return false; }
+bool ShardedHull::mapText(const QString&) { return false; }
+void ShardedHull::unmap() {}
+
+#endif
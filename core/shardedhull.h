@@ -0,0 +1,43 @@
+#ifndef SHARDEDHULL_H
+#define SHARDEDHULL_H
+
+#include <QVector>
+#include <QPoint>
+#include <QString>
+
+// Hull of a large point file computed by local worker processes.
+//
+// The coordinator maps the points into shared memory once and forks the workers, which
+// inherit the mapping and each compute the hull of one shard. Partial hulls come back
+// over pipes in the HullWire format and are merged in O(H log workers). Linux only.
+class ShardedHull
+{
+public:
+    ShardedHull(int workers);
+
+    // Points are read from raw qint32 x, y pairs, or from text with one "x y" pair per
+    // line when the file ends in .txt or .csv. Text numbers must be integers in the
+    // qint32 range.
+    bool compute(const QString& path);
+
+    QVector<QPoint> hull() const;
+    qint64 pointCount() const;
+    QString errorString() const;
+
+private:
+    int workers;
+    QVector<QPoint> result;
+    qint64 count = 0;
+    QString error;
+
+    // Shared point buffer, interleaved x, y
+    const qint32* xy = nullptr;
+    void* mapping = nullptr;
+    std::size_t mappingLength = 0;
+
+    bool mapBinary(const QString& path);
+    bool mapText(const QString& path);
+    void unmap();
+};
+
+#endif // SHARDEDHULL_H
@@ -0,0 +1,171 @@
+#include "slidingwindowhull.h"
+#include "hullutils.h"
+#include <iterator>
+
+using HullUtils::cross;
+
+namespace {
+
+QPoint mirror(const QPoint& p) {
+    return QPoint(p.x(), -p.y());
+}
+
+QPoint vertex(const std::pair<const int, int>& entry) {
+    return QPoint(entry.first, entry.second);
+}
+
+} // namespace
+
+void SlidingWindowHull::Chain::insert(const QPoint& p) {
+    auto next = vertices.lower_bound(p.x());
+    bool covered;
+    if (next != vertices.end() && next->first == p.x())
+        covered = next->second <= p.y();
+    else
+        covered = next != vertices.end() && next != vertices.begin() &&
+                  cross(vertex(*std::prev(next)), vertex(*next), p) >= 0;
+    if (covered) {
+        if (logged)
+            changes.push_back({false, p.x(), static_cast<int>(removed.size())});
+        return;
+    }
+
+    if (logged)
+        changes.push_back({true, p.x(), static_cast<int>(removed.size())});
+    auto drop = [this](std::map<int, int>::iterator at) {
+        if (logged)
+            removed.push_back(vertex(*at));
+        return vertices.erase(at);
+    };
+    if (next != vertices.end() && next->first == p.x())
+        next = drop(next);
+    // Vertices on either side that no longer turn left
+    while (next != vertices.begin() && std::prev(next) != vertices.begin()) {
+        auto a = std::prev(next);
+        if (cross(vertex(*std::prev(a)), vertex(*a), p) > 0)
+            break;
+        drop(a);
+    }
+    while (next != vertices.end() && std::next(next) != vertices.end() &&
+           cross(p, vertex(*next), vertex(*std::next(next))) <= 0)
+        next = drop(next);
+    vertices.emplace_hint(next, p.x(), p.y());
+}
+
+void SlidingWindowHull::Chain::undo() {
+    const Change change = changes.back();
+    changes.pop_back();
+    if (!change.inserted)
+        return;
+    vertices.erase(change.x);
+    for (int i = change.removedFrom; i < static_cast<int>(removed.size()); i++)
+        vertices.emplace(removed[i].x(), removed[i].y());
+    removed.resize(change.removedFrom);
+}
+
+void SlidingWindowHull::Chain::clear() {
+    vertices.clear();
+    changes.clear();
+    removed.clear();
+}
+
+void SlidingWindowHull::Chain::appendVertices(QVector<QPoint>& out, bool mirrored) const {
+    for (const auto& entry : vertices)
+        out.append(mirrored ? mirror(vertex(entry)) : vertex(entry));
+}
+
+SlidingWindowHull::SlidingWindowHull(int maxPoints, qint64 maxAgeMs)
+    : maxPoints(maxPoints), maxAgeMs(maxAgeMs) {}
+
+void SlidingWindowHull::setWindow(int maxPoints, qint64 maxAgeMs) {
+    this->maxPoints = maxPoints;
+    this->maxAgeMs = maxAgeMs;
+    if (!backTimes.empty())
+        expire(backTimes.back());
+    else if (!frontTimes.empty())
+        expire(frontTimes.front());
+}
+
+void SlidingWindowHull::clear() {
+    backPoints.clear();
+    backTimes.clear();
+    backLower.clear();
+    backUpper.clear();
+    frontPoints.clear();
+    frontTimes.clear();
+    frontLower.clear();
+    frontUpper.clear();
+    cachedHull.clear();
+    dirty = false;
+}
+
+int SlidingWindowHull::size() const {
+    return static_cast<int>(backPoints.size() + frontPoints.size());
+}
+
+void SlidingWindowHull::push(const QPoint& point, qint64 timestampMs) {
+    backPoints.push_back(point);
+    backTimes.push_back(timestampMs);
+    backLower.insert(point);
+    backUpper.insert(mirror(point));
+    expire(timestampMs);
+    dirty = true;
+}
+
+void SlidingWindowHull::expire(qint64 newestMs) {
+    while (size() > 0) {
+        const qint64 oldestMs = frontTimes.empty() ? backTimes.front() : frontTimes.back();
+        bool tooMany = maxPoints > 0 && size() > maxPoints;
+        bool tooOld = maxAgeMs > 0 && oldestMs < newestMs - maxAgeMs;
+        if (!tooMany && !tooOld)
+            break;
+        popOldest();
+        dirty = true;
+    }
+}
+
+void SlidingWindowHull::popOldest() {
+    if (frontPoints.empty()) {
+        // Move the back stack over newest first, so the oldest point is undone first
+        for (std::size_t i = backPoints.size(); i-- > 0;) {
+            frontPoints.push_back(backPoints[i]);
+            frontTimes.push_back(backTimes[i]);
+            frontLower.insert(backPoints[i]);
+            frontUpper.insert(mirror(backPoints[i]));
+        }
+        backPoints.clear();
+        backTimes.clear();
+        backLower.clear();
+        backUpper.clear();
+    }
+    frontPoints.pop_back();
+    frontTimes.pop_back();
+    frontLower.undo();
+    frontUpper.undo();
+}
+
+QVector<QPoint> SlidingWindowHull::windowPoints() const {
+    QVector<QPoint> result;
+    result.reserve(size());
+    for (auto it = frontPoints.rbegin(); it != frontPoints.rend(); ++it)
+        result.append(*it);
+    for (const QPoint& p : backPoints)
+        result.append(p);
+    return result;
+}
+
+QVector<QPoint> SlidingWindowHull::hull() {
+    if (!dirty)
+        return cachedHull;
+
+    // Only vertices of the two stack hulls can be on the window hull
+    QVector<QPoint> candidates;
+    frontLower.appendVertices(candidates, false);
+    frontUpper.appendVertices(candidates, true);
+    backLower.appendVertices(candidates, false);
+    backUpper.appendVertices(candidates, true);
+
+    cachedHull = HullUtils::monotoneChain(candidates);
+    dirty = false;
+    return cachedHull;
+}
@@ -0,0 +1,76 @@
+#ifndef SLIDINGWINDOWHULL_H
+#define SLIDINGWINDOWHULL_H
+
+#include <QVector>
+#include <QPoint>
+#include <map>
+#include <vector>
+
+// Convex hull of the most recent points of a timestamped stream.
+//
+// The window is a queue made of two stacks. New points go on the back stack, whose hull
+// only grows. When the oldest point expires and the front stack is empty, the back stack
+// is moved over newest first, and every insertion into the front hull is logged so it
+// can be undone; dropping the oldest point undoes the last insertion. Each point is
+// inserted at most twice and undone at most once, so push() is O(log h) amortized.
+// hull() merges the two hulls in O(h log h) and is cached until the window changes.
+class SlidingWindowHull
+{
+public:
+    // Keep at most maxPoints points and drop points older than maxAgeMs relative to the
+    // newest one. A limit of 0 disables it.
+    SlidingWindowHull(int maxPoints, qint64 maxAgeMs = 0);
+
+    void setWindow(int maxPoints, qint64 maxAgeMs = 0);
+    void push(const QPoint& point, qint64 timestampMs);
+    void clear();
+
+    int size() const;
+    QVector<QPoint> windowPoints() const;
+
+    // Hull of the points in the window, counter-clockwise
+    QVector<QPoint> hull();
+
+private:
+    // Lower hull of a growing point set, vertices by x. The upper hull is kept as the
+    // lower hull of the points mirrored in y.
+    class Chain {
+    public:
+        explicit Chain(bool logged) : logged(logged) {}
+        void insert(const QPoint& point);
+        void undo();  // Reverts the newest logged insert()
+        void clear();
+        void appendVertices(QVector<QPoint>& out, bool mirrored) const;
+
+    private:
+        struct Change {
+            bool inserted;
+            int x;
+            int removedFrom;  // Vertices removed by the insertion are removed[removedFrom..]
+        };
+        bool logged;
+        std::map<int, int> vertices;
+        std::vector<Change> changes;
+        std::vector<QPoint> removed;
+    };
+
+    int maxPoints;
+    qint64 maxAgeMs;
+
+    // Back stack, oldest first
+    std::vector<QPoint> backPoints;
+    std::vector<qint64> backTimes;
+    Chain backLower{false}, backUpper{false};
+    // Front stack, oldest last
+    std::vector<QPoint> frontPoints;
+    std::vector<qint64> frontTimes;
+    Chain frontLower{true}, frontUpper{true};
+
+    QVector<QPoint> cachedHull;
+    bool dirty = false;
+
+    void expire(qint64 newestMs);
+    void popOldest();
+};
+
+#endif // SLIDINGWINDOWHULL_H
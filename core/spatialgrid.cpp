@@ -0,0 +1,169 @@
+#include "spatialgrid.h"
+#include <climits>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(const QVector<QPoint>& points, int pointsPerCell)
+    : points(points) {
+    const int n = points.size();
+    if (n == 0) {
+        cellStart = QVector<int>(1, 0);
+        return;
+    }
+
+    int minX = INT_MAX, minY = INT_MAX, maxX = INT_MIN, maxY = INT_MIN;
+    for (const QPoint& p : points) {
+        minX = std::min(minX, p.x());
+        minY = std::min(minY, p.y());
+        maxX = std::max(maxX, p.x());
+        maxY = std::max(maxY, p.y());
+    }
+    origin = QPoint(minX, minY);
+    const qint64 width = static_cast<qint64>(maxX) - minX + 1;
+    const qint64 height = static_cast<qint64>(maxY) - minY + 1;
+    const double cellArea = static_cast<double>(width) * height * std::max(1, pointsPerCell) / n;
+    cellSize = std::max<qint64>(1, static_cast<qint64>(std::ceil(std::sqrt(cellArea))));
+    // Long thin inputs would get far more cells than points
+    while ((width + cellSize - 1) / cellSize * ((height + cellSize - 1) / cellSize) > 4 * static_cast<qint64>(n) + 16)
+        cellSize *= 2;
+    cols = static_cast<int>((width + cellSize - 1) / cellSize);
+    rowCount = static_cast<int>((height + cellSize - 1) / cellSize);
+
+    // Count the points per cell, turn the counts into offsets, then place the indices
+    QVector<int> cells(n);
+    cellStart = QVector<int>(cols * rowCount + 1, 0);
+    for (int i = 0; i < n; i++) {
+        cells[i] = row(points[i].y()) * cols + column(points[i].x());
+        cellStart[cells[i] + 1]++;
+    }
+    for (int c = 0; c < cols * rowCount; c++)
+        cellStart[c + 1] += cellStart[c];
+    order.resize(n);
+    QVector<int> fill(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < n; i++)
+        order[fill[cells[i]]++] = i;
+}
+
+int SpatialGrid::column(int x) const {
+    qint64 c = (static_cast<qint64>(x) - origin.x()) / cellSize;
+    return static_cast<int>(std::clamp<qint64>(c, 0, std::max(0, cols - 1)));
+}
+
+int SpatialGrid::row(int y) const {
+    qint64 r = (static_cast<qint64>(y) - origin.y()) / cellSize;
+    return static_cast<int>(std::clamp<qint64>(r, 0, std::max(0, rowCount - 1)));
+}
+
+void SpatialGrid::take(int from, int to, QVector<int>& result, QVector<QPoint>* inside) const {
+    for (int i = from; i < to; i++) {
+        result.append(order[i]);
+        if (inside)
+            inside->append(points[order[i]]);
+    }
+}
+
+QVector<int> SpatialGrid::query(const QRect& rect, QVector<QPoint>* inside) const {
+    QVector<int> result;
+    if (points.isEmpty() || rect.isEmpty())
+        return result;
+    const int x0 = column(rect.left()), x1 = column(rect.right());
+    const int y0 = row(rect.top()), y1 = row(rect.bottom());
+    for (int y = y0; y <= y1; y++) {
+        const bool innerRow = rowStart(y) >= rect.top() && rowStart(y + 1) - 1 <= rect.bottom();
+        for (int x = x0; x <= x1; x++) {
+            const int cell = y * cols + x;
+            if (innerRow && columnStart(x) >= rect.left() && columnStart(x + 1) - 1 <= rect.right()) {
+                // Cells inside the rectangle are taken whole
+                take(cellStart[cell], cellStart[cell + 1], result, inside);
+                continue;
+            }
+            for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                if (rect.contains(points[order[i]]))
+                    take(i, i + 1, result, inside);
+            }
+        }
+    }
+    return result;
+}
+
+QVector<int> SpatialGrid::query(const QVector<QPoint>& polygon, QVector<QPoint>* inside) const {
+    QVector<int> result;
+    const int m = polygon.size();
+    if (points.isEmpty() || m < 3)
+        return result;
+    int minX = INT_MAX, minY = INT_MAX, maxX = INT_MIN, maxY = INT_MIN;
+    for (const QPoint& p : polygon) {
+        minX = std::min(minX, p.x());
+        minY = std::min(minY, p.y());
+        maxX = std::max(maxX, p.x());
+        maxY = std::max(maxY, p.y());
+    }
+    const int x0 = column(minX), x1 = column(maxX);
+    const int y0 = row(minY), y1 = row(maxY);
+
+    // Polygon edges by the cell rows their y range overlaps
+    QVector<QVector<int>> rowEdges(y1 - y0 + 1);
+    for (int e = 0; e < m; e++) {
+        const QPoint& a = polygon[e];
+        const QPoint& b = polygon[(e + 1) % m];
+        for (int y = row(std::min(a.y(), b.y())); y <= row(std::max(a.y(), b.y())); y++)
+            rowEdges[y - y0].append(e);
+    }
+
+    // Even-odd test of a horizontal ray to the right, against the edges of one row
+    auto contains = [&polygon, m](double px, double py, const QVector<int>& edges) {
+        bool in = false;
+        for (int e : edges) {
+            const QPoint& a = polygon[e];
+            const QPoint& b = polygon[(e + 1) % m];
+            if ((a.y() > py) != (b.y() > py) &&
+                px < a.x() + (py - a.y()) * (b.x() - a.x()) / static_cast<double>(b.y() - a.y()))
+                in = !in;
+        }
+        return in;
+    };
+
+    QVector<char> crossed(x1 - x0 + 1);
+    for (int y = y0; y <= y1; y++) {
+        const QVector<int>& edges = rowEdges[y - y0];
+        const double top = rowStart(y), bottom = rowStart(y + 1) - 1;
+
+        // Mark the cells the edges pass through, with a cell of slack on either side.
+        // No edge enters an unmarked cell, so all of its points share the answer of its center.
+        crossed.fill(0);
+        for (int e : edges) {
+            const QPoint& a = polygon[e];
+            const QPoint& b = polygon[(e + 1) % m];
+            double left = std::min(a.x(), b.x()), right = std::max(a.x(), b.x());
+            if (a.y() != b.y()) {
+                // Part of the edge within the row
+                const double slope = (b.x() - a.x()) / static_cast<double>(b.y() - a.y());
+                const double xTop = a.x() + (std::clamp<double>(top, std::min(a.y(), b.y()), std::max(a.y(), b.y())) - a.y()) * slope;
+                const double xBottom = a.x() + (std::clamp<double>(bottom, std::min(a.y(), b.y()), std::max(a.y(), b.y())) - a.y()) * slope;
+                left = std::min(xTop, xBottom);
+                right = std::max(xTop, xBottom);
+            }
+            const int from = std::max(x0, column(static_cast<int>(std::floor(left))) - 1);
+            const int to = std::min(x1, column(static_cast<int>(std::ceil(right))) + 1);
+            for (int x = from; x <= to; x++)
+                crossed[x - x0] = 1;
+        }
+
+        for (int x = x0; x <= x1; x++) {
+            const int cell = y * cols + x;
+            if (cellStart[cell] == cellStart[cell + 1])
+                continue;
+            if (!crossed[x - x0]) {
+                const double cx = columnStart(x) + (cellSize - 1) / 2.0;
+                const double cy = rowStart(y) + (cellSize - 1) / 2.0;
+                if (contains(cx, cy, edges))
+                    take(cellStart[cell], cellStart[cell + 1], result, inside);
+                continue;
+            }
+            for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                if (contains(points[order[i]].x(), points[order[i]].y(), edges))
+                    take(i, i + 1, result, inside);
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,108 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <QVector>
+#include <QPoint>
+#include <QRect>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// Uniform grid over a point set for range and nearest neighbour queries.
+// The point indices are stored cell by cell in one array (compressed rows), so building
+// is two linear passes and a query only visits the cells it overlaps. The points are
+// shared with the caller's vector, so the grid itself only adds the index arrays.
+class SpatialGrid
+{
+public:
+    // Cells are sized for about pointsPerCell points each on uniform input
+    SpatialGrid(const QVector<QPoint>& points, int pointsPerCell = 2);
+
+    // Indices of the points inside rect, edges included. The points themselves are
+    // appended to inside when given, in the same order.
+    QVector<int> query(const QRect& rect, QVector<QPoint>* inside = nullptr) const;
+
+    // Indices of the points inside the closed polygon through the given vertices, by the
+    // even-odd rule
+    QVector<int> query(const QVector<QPoint>& polygon, QVector<QPoint>* inside = nullptr) const;
+
+    // Indices of the k nearest points to center for which accept(index) is true,
+    // nearest first
+    template <typename Accept>
+    QVector<int> nearest(const QPoint& center, int k, Accept accept) const;
+
+    int columns() const { return cols; }
+    int rows() const { return rowCount; }
+    int column(int x) const;
+    int row(int y) const;
+    qint64 columnStart(int column) const { return origin.x() + column * cellSize; }
+
+private:
+    QVector<QPoint> points;
+    QPoint origin;
+    qint64 cellSize = 1;
+    int cols = 0;
+    int rowCount = 0;
+    QVector<int> cellStart; // Points of cell c are order[cellStart[c]..cellStart[c + 1])
+    QVector<int> order;
+
+    qint64 rowStart(int row) const { return origin.y() + row * cellSize; }
+    // Appends the points order[from..to) to the query results
+    void take(int from, int to, QVector<int>& result, QVector<QPoint>* inside) const;
+};
+
+template <typename Accept>
+QVector<int> SpatialGrid::nearest(const QPoint& center, int k, Accept accept) const {
+    // Max heap of the k best candidates so far
+    std::vector<std::pair<qint64, int>> best;
+    if (k <= 0 || points.isEmpty())
+        return QVector<int>();
+
+    const int cx = column(center.x());
+    const int cy = row(center.y());
+    const int maxRing = std::max(cols, rowCount);
+    for (int r = 0; r <= maxRing; r++) {
+        // Cells at Chebyshev distance r from the center cell
+        for (int y = cy - r; y <= cy + r; y++) {
+            if (y < 0 || y >= rowCount)
+                continue;
+            const bool edgeRow = y == cy - r || y == cy + r;
+            for (int x = cx - r; x <= cx + r; x += edgeRow ? 1 : 2 * r) {
+                if (x >= 0 && x < cols) {
+                    const int cell = y * cols + x;
+                    for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+                        const int index = order[i];
+                        if (!accept(index))
+                            continue;
+                        const qint64 dx = points[index].x() - center.x();
+                        const qint64 dy = points[index].y() - center.y();
+                        const std::pair<qint64, int> candidate(dx * dx + dy * dy, index);
+                        if (static_cast<int>(best.size()) < k) {
+                            best.push_back(candidate);
+                            std::push_heap(best.begin(), best.end());
+                        } else if (candidate < best.front()) {
+                            std::pop_heap(best.begin(), best.end());
+                            best.back() = candidate;
+                            std::push_heap(best.begin(), best.end());
+                        }
+                    }
+                }
+                if (r == 0)
+                    break;
+            }
+        }
+        // Every cell outside this ring is more than r cells away
+        const qint64 reach = r * cellSize;
+        if (static_cast<int>(best.size()) == k && best.front().first <= reach * reach)
+            break;
+    }
+
+    std::sort_heap(best.begin(), best.end());
+    QVector<int> result;
+    result.reserve(static_cast<int>(best.size()));
+    for (const std::pair<qint64, int>& entry : best)
+        result.append(entry.second);
+    return result;
+}
+
+#endif // SPATIALGRID_H